@@ -0,0 +1,606 @@
+// Microbenchmark suite for the simulators, in the style of Google Benchmark.
+// Times simulateFIFO/SJF/SRT/RR/MLFQ from geminiversion.cpp, simulate_FIFO/SJF/SRT
+// from SchedulingAlgorithms.cpp and the engine driven by a runtime policy
+// (the baseline for the compile-time Simulator<Policy>), the busy-period
+// parallel run of BusyPeriods.h and the closed-form FIFO of FifoScan.h on all
+// cores, over a grid of
+// n (50 to 10^7), k and d. For each run it reports wall time, ns per event
+// (one arrival plus one completion per job), heap allocations per run and
+// peak RSS.
+//
+//   g++ -std=c++17 -O2 -pthread Benchmark.cpp -o Benchmark
+//   ./Benchmark [--filter=<substring>] [--max_n=<n>] [--min_time=<seconds>] [--csv]
+//   ./Benchmark --policies  Simulator<Policy> against DynamicPolicy; fails if ATT differs
+//   ./Benchmark --check-fifo  runFifoScan against the event engine's FIFO
+//   ./Benchmark --check-busy  runBusyPeriods against the sequential engine
+//   ./Benchmark --check-online  OnlineScheduler ticked in steps against batch runs
+//   ./Benchmark --intake    contention benchmark of JobIntake.h, 1 to 64 producers
+//   ./Benchmark --check-allocs  fails unless sweep replications stop allocating
+#define SCHEDULER_NO_MAIN
+#include "geminiversion.cpp"
+#include "SchedulingAlgorithms.cpp"
+#include "JobIntake.h"
+#include "BusyPeriods.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+
+#include <sys/resource.h>
+
+// --- Allocation Counting ---
+// Every operator new in the process goes through here. GCC flags the
+// malloc/free pairing as mismatched even though both sides are replaced.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// --- Peak RSS ---
+// Linux lets a process reset its high-water mark through clear_refs; where
+// that is not possible the numbers are the process-wide peak instead.
+static void resetPeakRss() {
+    std::ofstream clear("/proc/self/clear_refs");
+    if (clear) clear << "5";
+}
+
+static long peakRssKb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) return std::atol(line.c_str() + 6);
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// --- Runtime Policy ---
+// Same ordering rules as KeyPolicy, but chosen per run, so every key lookup
+// and preemption check is a runtime branch. The ready queue is a type and is
+// picked per run by withDynamicPolicy(), as KeyPolicy picks it, so the
+// comparison only measures the dispatch.
+template <typename ReadyQueue>
+struct DynamicPolicy {
+    using Queue = ReadyQueue;
+    QueueKey keyKind;
+    bool preemptive;
+
+    template <typename Jobs>
+    long long key(Jobs& jobs, int slot) const {
+        switch (keyKind) {
+            case QueueKey::Arrival:      return jobs.arrival(slot);
+            case QueueKey::Index:        return jobs.id(slot);
+            case QueueKey::TotalCpu:     return jobs.burst(slot);
+            case QueueKey::RemainingCpu: return jobs.remaining(slot);
+        }
+        return jobs.id(slot);
+    }
+
+    template <typename Jobs>
+    int tieBreak(Jobs& jobs, int slot) const { return jobs.id(slot); }
+};
+
+// Calls fn with the runtime policy for (key, preemptive): a FIFO ring for
+// non-preemptive arrival order, a min-heap for everything else
+template <typename Fn>
+auto withDynamicPolicy(QueueKey key, bool preemptive, Fn&& fn) {
+    if (key == QueueKey::Arrival && !preemptive) return fn(DynamicPolicy<FifoReadyQueue>{key, preemptive});
+    return fn(DynamicPolicy<MinHeapReadyQueue>{key, preemptive});
+}
+
+// --- Benchmark Registry ---
+// Inputs shared by every benchmark of one grid point
+struct Fixture {
+    Workload workload;
+    std::vector<Process> procs; // Same jobs in SchedulingAlgorithms.cpp's layout
+};
+
+struct Benchmark {
+    std::string name;
+    std::function<void(Fixture&)> run; // One simulation
+};
+
+// Swallows the "ATT = ..." lines simulate_* print
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+static std::vector<Benchmark> registerBenchmarks() {
+    static NullBuffer nullBuffer;
+    auto quiet = [](void (*fn)(std::vector<Process>)) {
+        return [fn](Fixture& f) {
+            std::streambuf* previous = std::cout.rdbuf(&nullBuffer);
+            fn(f.procs);
+            std::cout.rdbuf(previous);
+        };
+    };
+    static WorkStealingPool pool;
+    auto dynamic = [](QueueKey key, bool preemptive) {
+        return [key, preemptive](Fixture& f) {
+            withDynamicPolicy(key, preemptive, [&](auto policy) { Simulator<decltype(policy)>(policy).run(f.workload); });
+        };
+    };
+    return {
+        { "simulateFIFO", [](Fixture& f) { simulateFIFO(f.workload); } },
+        { "simulateSJF", [](Fixture& f) { simulateSJF(f.workload); } },
+        { "simulateSRT", [](Fixture& f) { simulateSRT(f.workload); } },
+        { "simulateRR/q:10", [](Fixture& f) { simulateRR(f.workload, 10); } },
+        { "simulateMLFQ/l:4/q:10", [](Fixture& f) { simulateMLFQ(f.workload, mlfqConfig(4, 10, 0)); } },
+        { "simulate_FIFO", quiet(simulate_FIFO) },
+        { "simulate_SJF", quiet(simulate_SJF) },
+        { "simulate_SRT", quiet(simulate_SRT) },
+        { "Simulator<DynamicPolicy>/FIFO", dynamic(QueueKey::Arrival, false) },
+        { "Simulator<DynamicPolicy>/SJF", dynamic(QueueKey::TotalCpu, false) },
+        { "Simulator<DynamicPolicy>/SRT", dynamic(QueueKey::RemainingCpu, true) },
+        { "runFifoScan", [](Fixture& f) { runFifoScan(f.workload, pool); } },
+        { "runBusyPeriods<FifoPolicy>", [](Fixture& f) { runBusyPeriods<FifoPolicy>(f.workload, pool); } },
+        { "runBusyPeriods<SjfPolicy>", [](Fixture& f) { runBusyPeriods<SjfPolicy>(f.workload, pool); } },
+        { "runBusyPeriods<SrtPolicy>", [](Fixture& f) { runBusyPeriods<SrtPolicy>(f.workload, pool); } },
+    };
+}
+
+// --- Template vs Runtime Policy ---
+// Best wall time of Simulator<Policy> against the same loop driven by
+// DynamicPolicy on one workload per n, with the speedup of the template and
+// whether both produced the same ATT. Fails on any ATT mismatch.
+template <typename Policy>
+static double timePolicy(Workload& w, Policy policy, int repetitions, double& att) {
+    Simulator<Policy> simulator(policy);
+    double best = 1e300;
+    for (int r = 0; r < repetitions; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        simulator.run(w);
+        best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    att = reduceTurnaround(w).mean;
+    return best;
+}
+
+static bool comparePolicies(long long max_n) {
+    const int repetitions = 5;
+    const std::vector<int> n_values = { 50, 10000, 100000, 1000000 };
+    bool ok = true;
+    std::cout << "n\tpolicy\ttemplate_ms\truntime_ms\tspeedup\tsame_ATT\n";
+    std::cout << std::fixed << std::setprecision(3);
+    for (int n : n_values) {
+        if (n > max_n) continue;
+        // Moderate contention: mean burst equals the mean arrival interval
+        std::mt19937 gen(12345);
+        Workload w;
+        generateWorkload(w, n, n * 20, 20.0, 6.0, gen);
+
+        double attStatic, attDynamic, staticNs, dynamicNs;
+        auto report = [&](const char* name) {
+            bool same = attStatic == attDynamic;
+            if (!same) ok = false;
+            std::cout << n << "\t" << name << "\t" << staticNs / 1e6 << "\t" << dynamicNs / 1e6 << "\t"
+                      << dynamicNs / staticNs << "\t" << (same ? "yes" : "NO") << "\n";
+        };
+
+        staticNs = timePolicy(w, FifoPolicy(), repetitions, attStatic);
+        dynamicNs = withDynamicPolicy(QueueKey::Arrival, false, [&](auto policy) {
+            return timePolicy(w, policy, repetitions, attDynamic);
+        });
+        report("FIFO");
+        staticNs = timePolicy(w, SjfPolicy(), repetitions, attStatic);
+        dynamicNs = withDynamicPolicy(QueueKey::TotalCpu, false, [&](auto policy) {
+            return timePolicy(w, policy, repetitions, attDynamic);
+        });
+        report("SJF");
+        staticNs = timePolicy(w, SrtPolicy(), repetitions, attStatic);
+        dynamicNs = withDynamicPolicy(QueueKey::RemainingCpu, true, [&](auto policy) {
+            return timePolicy(w, policy, repetitions, attDynamic);
+        });
+        report("SRT");
+    }
+    std::cout << (ok ? "OK: template and runtime policies agree" : "FAIL: ATT differs between policies") << std::endl;
+    return ok;
+}
+
+// --- Closed-Form FIFO Check ---
+// Runs random workloads through runFifoScan(), serially and on the pool, and
+// through runEventSimulation() with FIFO ordering, and compares ATT and every
+// completion time. The grid covers both sides of kFifoScanSerialCutoff, many
+// tied arrivals (k much smaller than n) and long idle gaps (d much smaller
+// than k/n).
+static bool checkFifoScan() {
+    static WorkStealingPool pool;
+    const std::vector<int> n_values = { 1, 2, 50, 1000, 2047, 2048, 10000, 100000 };
+    const std::vector<double> intervals = { 0.01, 1.0, 50.0 };
+    const std::vector<double> d_factors = { 0.05, 1.0, 20.0 };
+    bool ok = true;
+    size_t cases = 0;
+    for (int n : n_values) {
+        for (double interval : intervals) {
+            for (double factor : d_factors) {
+                for (uint64_t seed = 0; seed < 3; ++seed) {
+                    int k = std::max(1, static_cast<int>(n * interval));
+                    double d = std::max(1.0, interval * factor);
+                    std::mt19937 gen = taskGenerator(7, cases++);
+                    Workload expected;
+                    generateWorkload(expected, n, k, d, std::max(1.0, d * 0.5), gen);
+                    Workload serial = expected, parallel = expected;
+                    runEventSimulation(expected, QueueKey::Arrival, false);
+                    runFifoScan(serial);
+                    runFifoScan(parallel, pool);
+
+                    double att = reduceTurnaround(expected).mean;
+                    for (const Workload* w : { &serial, &parallel }) {
+                        if (w->completionTime == expected.completionTime && reduceTurnaround(*w).mean == att) continue;
+                        std::cout << "MISMATCH n:" << n << "/k:" << k << "/d:" << d << "/seed:" << seed
+                                  << (w == &serial ? " serial" : " pool") << ": ATT " << reduceTurnaround(*w).mean
+                                  << " vs " << att << "\n";
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+    std::cout << (ok ? "OK: " : "FAIL: ") << cases << " workloads, runFifoScan "
+              << (ok ? "matches" : "differs from") << " the event engine" << std::endl;
+    return ok;
+}
+
+// --- Busy-Period Check ---
+// Runs random workloads through runBusyPeriods<Policy>() on the pool and
+// through Simulator<Policy> sequentially, and compares every completion time,
+// for FIFO, SJF and SRT. The grid mixes long idle gaps, many equal arrivals
+// and workloads shifted so that some jobs arrive before time 0.
+template <typename Policy>
+static bool busyPeriodsMatch(const Workload& w, WorkStealingPool& pool) {
+    Workload expected = w, split = w;
+    Simulator<Policy>().run(expected);
+    runBusyPeriods<Policy>(split, pool);
+    return split.completionTime == expected.completionTime;
+}
+
+static bool checkBusyPeriods() {
+    static WorkStealingPool pool;
+    const std::vector<int> n_values = { 1, 2, 50, 1000, 20000 };
+    bool ok = true;
+    size_t cases = 0;
+    for (int n : n_values) {
+        for (double interval : { 0.01, 1.0, 50.0 }) {
+            for (double d : { 1.0, 5.0, 100.0 }) {
+                for (int shift : { 0, -1, -1000 }) {
+                    int k = std::max(1, static_cast<int>(n * interval));
+                    std::mt19937 gen = taskGenerator(13, cases++);
+                    Workload w;
+                    generateWorkload(w, n, k, d, std::max(1.0, d * 0.5), gen);
+                    for (int& a : w.arrivalTime) a += shift;
+                    const char* failed = !busyPeriodsMatch<FifoPolicy>(w, pool) ? "FIFO"
+                                         : !busyPeriodsMatch<SjfPolicy>(w, pool) ? "SJF"
+                                         : !busyPeriodsMatch<SrtPolicy>(w, pool) ? "SRT" : nullptr;
+                    if (failed) {
+                        std::cout << "MISMATCH " << failed << " n:" << n << "/k:" << k << "/d:" << d
+                                  << "/shift:" << shift << "\n";
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+    std::cout << (ok ? "OK: " : "FAIL: ") << cases << " workloads, runBusyPeriods "
+              << (ok ? "matches" : "differs from") << " the sequential engine" << std::endl;
+    return ok;
+}
+
+// --- Online Scheduler Check ---
+// Feeds random workloads to an OnlineScheduler job by job and advances it with
+// tickUntil(), alternating between the exact time of its next event (so
+// arrivals and completions land on the limit, often together) and random
+// steps. Every completion time must equal the batch Simulator<Policy>'s, and
+// each tickUntil(t) must report every completion at or before t. With
+// reverseTies, jobs arriving together are submitted in decreasing id order.
+template <typename Policy>
+static bool onlineMatchesBatch(Workload& w, std::mt19937& gen, bool reverseTies) {
+    Simulator<Policy>().run(w);
+    std::vector<long long> completion(w.size(), -1);
+    std::vector<long long> batchTimes = w.completionTime;
+    std::sort(batchTimes.begin(), batchTimes.end());
+    size_t reported = 0;
+    OnlineScheduler<Policy> scheduler;
+    ArrivalIndex order(w.arrivalTime);
+    CompletionEvent done;
+    std::vector<int> tied;
+    std::uniform_int_distribution<int> step(1, 8);
+    const long long never = std::numeric_limits<long long>::max();
+    for (int tick = 0; order.nextArrivalTime() != never || scheduler.liveJobs() > 0 ||
+                       scheduler.nextEventTime() != never;
+         ++tick) {
+        // Next unsubmitted arrival, or the scheduler's own next event, or a step
+        long long limit = tick % 2 ? scheduler.nextEventTime() : scheduler.now() + step(gen);
+        limit = std::min(limit, std::max(scheduler.now() + 1, order.nextArrivalTime()));
+        while (order.nextArrivalTime() != never && order.nextArrivalTime() <= limit) {
+            const long long arrival = order.nextArrivalTime();
+            tied.clear();
+            while (order.nextArrivalTime() == arrival) tied.push_back(order.next());
+            if (reverseTies) std::reverse(tied.begin(), tied.end());
+            for (int job : tied) {
+                if (!scheduler.submit(job, w.arrivalTime[job], w.totalCpuTime[job])) return false;
+            }
+        }
+        scheduler.tickUntil(limit);
+        for (; scheduler.nextCompletion(done); ++reported) completion[done.id] = done.time;
+        size_t due = std::upper_bound(batchTimes.begin(), batchTimes.end(), limit) - batchTimes.begin();
+        if (reported != due) return false;
+    }
+    for (size_t i = 0; i < w.size(); ++i) {
+        if (completion[i] != w.completionTime[i]) return false;
+    }
+    return true;
+}
+
+static bool checkOnlineScheduler() {
+    const std::vector<int> n_values = { 1, 10, 200, 5000 };
+    bool ok = true;
+    size_t cases = 0;
+    for (int n : n_values) {
+        for (double interval : { 0.2, 1.0, 5.0 }) {
+            for (double d : { 1.0, 3.0, 10.0 }) {
+                for (uint64_t seed = 0; seed < 4; ++seed) { // Odd seeds submit ties by falling id
+                    std::mt19937 gen = taskGenerator(11, cases++);
+                    Workload w;
+                    generateWorkload(w, n, std::max(1, static_cast<int>(n * interval)), d, std::max(1.0, d * 0.5), gen);
+                    const bool reverseTies = seed % 2 == 1;
+                    const char* failed = !onlineMatchesBatch<FifoPolicy>(w, gen, reverseTies) ? "FIFO"
+                                         : !onlineMatchesBatch<SjfPolicy>(w, gen, reverseTies) ? "SJF"
+                                         : !onlineMatchesBatch<SrtPolicy>(w, gen, reverseTies) ? "SRT" : nullptr;
+                    if (failed) {
+                        std::cout << "MISMATCH " << failed << " n:" << n << "/interval:" << interval << "/d:" << d
+                                  << "/seed:" << seed << "\n";
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+    std::cout << (ok ? "OK: " : "FAIL: ") << cases << " workloads, tickUntil() "
+              << (ok ? "matches" : "differs from") << " batch runs" << std::endl;
+    return ok;
+}
+
+// --- Intake Contention ---
+// P producer threads submit kIntakeJobs jobs in total while the main thread
+// drains them in batches into an OnlineScheduler<SrtPolicy>, once through the
+// lock-free JobIntake ring and once through a mutex-guarded deque for
+// comparison. Reports end-to-end submission throughput.
+constexpr size_t kIntakeJobs = size_t(1) << 20;
+constexpr size_t kIntakeBatch = 256;
+
+template <typename Push, typename Drain>
+static double runIntake(unsigned producers, Push push, Drain drain) {
+    OnlineScheduler<SrtPolicy> scheduler;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (size_t j = p; j < kIntakeJobs; j += producers) {
+                push(JobRecord{static_cast<int>(j), 0, 1 + static_cast<int>(j % 7)});
+            }
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    size_t received = 0;
+    CompletionEvent done;
+    DispatchEvent dispatched;
+    while (received < kIntakeJobs) {
+        size_t taken = drain(scheduler);
+        received += taken;
+        if (taken == 0) std::this_thread::yield();
+        scheduler.tickUntil(scheduler.now() + static_cast<long long>(4 * taken) + 1);
+        while (scheduler.nextCompletion(done)) {}
+        while (scheduler.nextDispatch(dispatched)) {}
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (auto& t : threads) t.join();
+    return kIntakeJobs / elapsed;
+}
+
+static void runIntakeContention() {
+    std::cout << "producers\tlockfree_Mjobs_per_s\tfull_waits_per_job\tmutex_Mjobs_per_s\n";
+    std::cout << std::fixed << std::setprecision(3);
+    for (unsigned producers = 1; producers <= 64; producers *= 2) {
+        JobIntake intake(4096);
+        std::atomic<size_t> waits{0};
+        size_t rejected = 0;
+        double lockFree = runIntake(
+            producers,
+            [&](const JobRecord& job) {
+                size_t w = intake.push(job);
+                if (w) waits.fetch_add(w, std::memory_order_relaxed);
+            },
+            [&](OnlineScheduler<SrtPolicy>& scheduler) { return admitFromIntake(intake, scheduler, kIntakeBatch, &rejected); });
+        if (rejected) std::cerr << "Warning: scheduler rejected " << rejected << " intake jobs" << std::endl;
+
+        std::mutex lock;
+        std::deque<JobRecord> queue;
+        double locked = runIntake(
+            producers,
+            [&](const JobRecord& job) {
+                std::lock_guard<std::mutex> guard(lock);
+                queue.push_back(job);
+            },
+            [&](OnlineScheduler<SrtPolicy>& scheduler) {
+                std::lock_guard<std::mutex> guard(lock);
+                size_t taken = 0;
+                for (; taken < kIntakeBatch && !queue.empty(); ++taken) {
+                    scheduler.submit(queue.front().id, scheduler.now(), queue.front().burst);
+                    queue.pop_front();
+                }
+                return taken;
+            });
+
+        std::cout << producers << "\t" << lockFree / 1e6 << "\t"
+                  << static_cast<double>(waits.load()) / kIntakeJobs << "\t" << locked / 1e6 << "\n";
+    }
+}
+
+// --- Steady-State Allocation Check ---
+// Runs sweep replications the way geminiversion does, through one reused
+// SimulationContext per point, and counts heap allocations after a warm-up
+// replication. Every replication after the first must make none: seeding,
+// generation, arrival ordering, the engine and the ATT reduction all reuse
+// the context's storage.
+static bool checkSteadyStateAllocations() {
+    const std::vector<SweepPoint> points = {
+        {1.0, 0.1, 50, 100}, {20.0, 0.3, 1000, 2000}, {100.0, 0.5, 10000, 20000}, {4.0, 0.9, 10000, 20000}};
+    const int replications = 20;
+    bool ok = true;
+    std::cout << "point\tallocs_warmup\tallocs_per_replication\n";
+    for (size_t p = 0; p < points.size(); ++p) {
+        const SweepPoint& point = points[p];
+        SimulationContext context;
+        double sink = 0;
+        size_t warmup = 0, steady = 0;
+        for (int r = 0; r < replications; ++r) {
+            size_t before = g_allocations.load();
+            std::mt19937 gen = taskGenerator(42, p * replications + r);
+            context.generate(point.n, point.k, point.d, std::max(1.0, point.d * point.vPct), gen);
+            sink += context.run<FifoPolicy>() + context.run<SjfPolicy>() + context.run<SrtPolicy>();
+            (r == 0 ? warmup : steady) += g_allocations.load() - before;
+        }
+        std::cout << "n:" << point.n << "/k:" << point.k << "/d:" << point.d << "\t" << warmup << "\t"
+                  << static_cast<double>(steady) / (replications - 1) << (sink > 0 ? "\n" : " (no jobs)\n");
+        if (steady != 0) ok = false;
+    }
+    std::cout << (ok ? "OK: no allocations after warm-up" : "FAIL: replications allocate after warm-up") << std::endl;
+    return ok;
+}
+
+// --- Main Driver ---
+int main(int argc, char* argv[]) {
+    std::string filter;
+    long long max_n = 10000000;
+    double min_time = 0.2; // Seconds of repeated runs per benchmark
+    bool csv = false;
+    std::string mode; // One of the modes below instead of the timing grid
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 9, "--filter=") == 0) filter = arg.substr(9);
+        else if (arg.compare(0, 8, "--max_n=") == 0) max_n = std::atoll(arg.c_str() + 8);
+        else if (arg.compare(0, 11, "--min_time=") == 0) min_time = std::atof(arg.c_str() + 11);
+        else if (arg == "--csv") csv = true;
+        else if (mode.empty() && (arg == "--intake" || arg == "--policies" || arg == "--check-fifo" ||
+                                  arg == "--check-busy" || arg == "--check-online" || arg == "--check-allocs")) {
+            mode = arg;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--filter=<substring>] [--max_n=<n>] "
+                      << "[--min_time=<seconds>] [--csv] | --policies | --intake | --check-fifo | "
+                      << "--check-busy | --check-online | --check-allocs" << std::endl;
+            return 1;
+        }
+    }
+
+    // Modes run after every flag is parsed, so flags may follow them
+    if (mode == "--intake") {
+        runIntakeContention();
+        return 0;
+    }
+    if (mode == "--policies") return comparePolicies(max_n) ? 0 : 1;
+    if (mode == "--check-fifo") return checkFifoScan() ? 0 : 1;
+    if (mode == "--check-busy") return checkBusyPeriods() ? 0 : 1;
+    if (mode == "--check-online") return checkOnlineScheduler() ? 0 : 1;
+    if (mode == "--check-allocs") return checkSteadyStateAllocations() ? 0 : 1;
+
+    // Grid: k is expressed as the mean arrival interval k/n, d relative to it
+    const std::vector<int> n_values = { 50, 1000, 10000, 100000, 1000000, 10000000 };
+    const std::vector<double> intervals = { 2.0, 20.0 };
+    const std::vector<double> d_factors = { 0.5, 1.0, 2.0 };
+    const double v_percentage = 0.3;
+    std::vector<Benchmark> benchmarks = registerBenchmarks();
+
+    if (csv) {
+        std::cout << "name,n,k,d,iterations,ns_per_run,ns_per_event,allocs_per_run,peak_rss_kb\n";
+    } else {
+        std::cout << std::left << std::setw(64) << "Benchmark" << std::right << std::setw(16) << "Time"
+                  << std::setw(12) << "Iterations" << std::setw(12) << "ns/event" << std::setw(14)
+                  << "allocs/run" << std::setw(14) << "peak_RSS_MB" << "\n"
+                  << std::string(132, '-') << "\n";
+    }
+
+    for (int n : n_values) {
+        if (n > max_n) continue;
+        for (double interval : intervals) {
+            for (double factor : d_factors) {
+                int k = static_cast<int>(n * interval);
+                double d = interval * factor;
+                std::ostringstream suffix;
+                suffix << "/n:" << n << "/k:" << k << "/d:" << d;
+
+                Fixture fixture;
+                bool built = false;
+                for (const Benchmark& b : benchmarks) {
+                    std::string name = b.name + suffix.str();
+                    if (!filter.empty() && name.find(filter) == std::string::npos) continue;
+                    if (!built) {
+                        std::mt19937 gen(12345);
+                        fixture.workload = generateProcesses(n, k, d, std::max(1.0, d * v_percentage), gen);
+                        fixture.procs.clear();
+                        for (int i = 0; i < n; ++i) {
+                            int total = fixture.workload.totalCpuTime[i];
+                            fixture.procs.push_back({i, fixture.workload.arrivalTime[i], total, total, 0, false});
+                        }
+                        built = true;
+                    }
+
+                    resetPeakRss();
+                    size_t iterations = 0;
+                    size_t allocations = g_allocations.load();
+                    auto start = std::chrono::steady_clock::now();
+                    double elapsed = 0;
+                    do {
+                        b.run(fixture);
+                        iterations++;
+                        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    } while (elapsed < min_time);
+                    allocations = g_allocations.load() - allocations;
+
+                    double ns_per_run = elapsed * 1e9 / iterations;
+                    double ns_per_event = ns_per_run / (2.0 * n);
+                    double allocs_per_run = static_cast<double>(allocations) / iterations;
+                    long rss_kb = peakRssKb();
+                    if (csv) {
+                        std::cout << b.name << "," << n << "," << k << "," << d << "," << iterations << ","
+                                  << ns_per_run << "," << ns_per_event << "," << allocs_per_run << ","
+                                  << rss_kb << "\n";
+                    } else {
+                        std::ostringstream time;
+                        time << std::fixed << std::setprecision(0) << ns_per_run << " ns";
+                        std::cout << std::left << std::setw(64) << name << std::right << std::setw(16)
+                                  << time.str() << std::setw(12) << iterations << std::fixed
+                                  << std::setprecision(2) << std::setw(12) << ns_per_event << std::setw(14)
+                                  << allocs_per_run << std::setw(14) << rss_kb / 1024.0 << "\n";
+                    }
+                    std::cout.flush();
+                }
+            }
+        }
+    }
+    return 0;
+}
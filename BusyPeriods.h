@@ -0,0 +1,224 @@
+// Parallel run of one large workload, split at the points where the CPU goes
+// idle. Every policy of the event engine is work-conserving, so the CPU is
+// busy exactly while unfinished work is waiting, whatever the order jobs run
+// in. Where the CPU goes idle nothing is running and nothing is queued, so
+// the jobs after that point are scheduled exactly as if the run had started
+// there. Each busy period can therefore be simulated on its own, and the
+// completion times (and all statistics derived from them) equal those of a
+// single sequential run.
+//
+// The boundaries follow from arrivals and bursts alone. Over jobs sorted by
+// (arrival, index), the time the CPU goes idle after job i is
+//   E_i = max(E_{i-1}, a_i) + b_i,   E_{-1} = 0 (the clock starts at 0),
+// and job i opens a new busy period when E_{i-1} < a_i. Each step is the map
+// x -> max(x + B, A) with B = b_i and A = a_i + b_i, and such maps compose into
+// one of the same form (IdleMap), so E is a prefix scan: every chunk of the
+// order folds its jobs into one map in parallel, a short sequential pass
+// over the chunks gives each chunk's incoming E, and a second parallel pass
+// finds the boundaries. Busy periods are then grouped into about one segment
+// per chunk and the segments are simulated concurrently.
+//
+//   WorkStealingPool pool;
+//   runBusyPeriods<SjfPolicy>(workload, pool);
+//   double att = reduceTurnaround(workload).mean;
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+#include "EventEngine.h"
+#include "SweepRunner.h"
+#include "Workload.h"
+
+// --- Parallel Arrival Sort ---
+// Job indices sorted by (arrival time, index), the order ArrivalIndex uses,
+// by a stable LSD radix sort on arrival - min(arrival): kRadixBits per pass
+// and only as many passes as the arrival range needs. Each pass counts digits
+// per chunk in parallel and scatters chunk by chunk, so equal keys keep index
+// order. Arrivals that are already in order (e.g. from a trace) are detected
+// up front and skip the sort.
+//
+// If `sorted` is given it also receives every job's arrival and burst in the
+// sorted order. Both are carried through the passes, so callers that stream
+// through the jobs in order never have to gather them by index.
+constexpr int kRadixBits = 11;
+
+struct SortedJobs {
+    std::vector<int> arrival;
+    std::vector<int> burst;
+};
+
+inline void sortByArrival(const Workload& w, std::vector<int>& order, WorkStealingPool& pool, size_t chunks,
+                          SortedJobs* sorted = nullptr) {
+    constexpr size_t kBuckets = size_t(1) << kRadixBits;
+    const size_t n = w.size();
+    const int* arrival = w.arrivalTime.data();
+    const int* burst = w.totalCpuTime.data();
+    order.resize(n);
+    if (sorted) {
+        sorted->arrival.resize(n);
+        sorted->burst.resize(n);
+    }
+    if (n == 0) return;
+    chunks = std::max<size_t>(1, std::min(chunks, n));
+    auto bound = [&](size_t c) { return std::min(n, c * ((n + chunks - 1) / chunks)); };
+
+    std::vector<int> low(chunks, std::numeric_limits<int>::max()), high(chunks, std::numeric_limits<int>::min());
+    std::vector<char> ordered(chunks, 1);
+    pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+        for (size_t i = bound(c); i < bound(c + 1); ++i) {
+            low[c] = std::min(low[c], arrival[i]);
+            high[c] = std::max(high[c], arrival[i]);
+            if (i > 0 && arrival[i - 1] > arrival[i]) ordered[c] = 0;
+        }
+    });
+    if (std::find(ordered.begin(), ordered.end(), 0) == ordered.end()) {
+        pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+            std::iota(order.begin() + bound(c), order.begin() + bound(c + 1), static_cast<int>(bound(c)));
+            if (sorted) {
+                std::copy(arrival + bound(c), arrival + bound(c + 1), sorted->arrival.begin() + bound(c));
+                std::copy(burst + bound(c), burst + bound(c + 1), sorted->burst.begin() + bound(c));
+            }
+        });
+        return;
+    }
+    const int base = *std::min_element(low.begin(), low.end());
+    const uint32_t range = static_cast<uint32_t>(*std::max_element(high.begin(), high.end())) - static_cast<uint32_t>(base);
+    const int passes = (32 - __builtin_clz(range) + kRadixBits - 1) / kRadixBits; // range > 0 here
+
+    std::vector<uint32_t> keys, keysOut(passes > 1 ? n : 0);
+    std::vector<int> indexOut(n), bursts, burstsOut(sorted && passes > 1 ? n : 0);
+    std::vector<size_t> next(chunks * kBuckets);
+    for (int pass = 0; pass < passes; ++pass) {
+        const int shift = pass * kRadixBits;
+        const bool first = pass == 0, last = pass + 1 == passes;
+        auto keyAt = [&](size_t i) {
+            return first ? static_cast<uint32_t>(arrival[i]) - static_cast<uint32_t>(base) : keys[i];
+        };
+        pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+            size_t* count = &next[c * kBuckets];
+            std::fill(count, count + kBuckets, 0);
+            for (size_t i = bound(c); i < bound(c + 1); ++i) count[(keyAt(i) >> shift) & (kBuckets - 1)]++;
+        });
+        size_t position = 0; // Digit-major, then chunk order
+        for (size_t d = 0; d < kBuckets; ++d) {
+            for (size_t c = 0; c < chunks; ++c) {
+                size_t count = next[c * kBuckets + d];
+                next[c * kBuckets + d] = position;
+                position += count;
+            }
+        }
+        pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+            size_t* slot = &next[c * kBuckets];
+            for (size_t i = bound(c); i < bound(c + 1); ++i) {
+                uint32_t key = keyAt(i);
+                size_t to = slot[(key >> shift) & (kBuckets - 1)]++;
+                indexOut[to] = first ? static_cast<int>(i) : order[i];
+                if (!last) {
+                    keysOut[to] = key;
+                    if (sorted) burstsOut[to] = first ? burst[i] : bursts[i];
+                } else if (sorted) {
+                    sorted->arrival[to] = static_cast<int>(key + static_cast<uint32_t>(base));
+                    sorted->burst[to] = first ? burst[i] : bursts[i];
+                }
+            }
+        });
+        order.swap(indexOut);
+        if (!last) {
+            keys.swap(keysOut);
+            bursts.swap(burstsOut);
+            keysOut.resize(n);
+            if (sorted) burstsOut.resize(n);
+        }
+    }
+}
+
+// --- Idle-Time Maps ---
+// A run of jobs, in arrival order and each run to completion as soon as the
+// CPU is free, as the map x -> max(x + B, A) from the time x the CPU becomes
+// free before them to the time it is free after them. B is their total
+// burst and A the time they finish on a CPU that was idle.
+struct IdleMap {
+    long long B = 0;
+    long long A = std::numeric_limits<long long>::min();
+
+    void add(int arrival, int burst) {
+        B += burst;
+        A = std::max(A, static_cast<long long>(arrival)) + burst;
+    }
+};
+
+// Time the CPU is free before each run, given the maps of consecutive runs.
+// The engine's clock starts at 0, so that is when the first run may start.
+inline std::vector<long long> idleBefore(const std::vector<IdleMap>& maps) {
+    std::vector<long long> idle(maps.size());
+    long long t = 0;
+    for (size_t c = 0; c < maps.size(); ++c) {
+        idle[c] = t;
+        t = std::max(t + maps[c].B, maps[c].A);
+    }
+    return idle;
+}
+
+// --- Busy-Period Partitioned Run ---
+// Fills in remainingCpuTime and completionTime for every job, like
+// Simulator<Policy>().run(w) after w.reset(), and returns the number of busy
+// periods. `chunks` sets the parallel grain (default: 4 per thread).
+template <typename Policy>
+size_t runBusyPeriods(Workload& w, WorkStealingPool& pool, size_t chunks = 0) {
+    const size_t n = w.size();
+    if (n == 0) return 0;
+    if (chunks == 0) chunks = 4 * static_cast<size_t>(pool.threadCount());
+    chunks = std::max<size_t>(1, std::min(chunks, n));
+    const size_t chunkSize = (n + chunks - 1) / chunks;
+    chunks = (n + chunkSize - 1) / chunkSize;
+    auto bound = [&](size_t c) { return std::min(n, c * chunkSize); };
+
+    std::vector<int> order;
+    sortByArrival(w, order, pool, chunks);
+    const int* arrival = w.arrivalTime.data();
+    const int* burst = w.totalCpuTime.data();
+
+    // Pass 1: each chunk as one map, and reset its jobs
+    std::vector<IdleMap> maps(chunks);
+    pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+        IdleMap m;
+        for (size_t i = bound(c); i < bound(c + 1); ++i) m.add(arrival[order[i]], burst[order[i]]);
+        maps[c] = m;
+        std::copy(w.totalCpuTime.begin() + bound(c), w.totalCpuTime.begin() + bound(c + 1),
+                  w.remainingCpuTime.begin() + bound(c));
+        std::fill(w.completionTime.begin() + bound(c), w.completionTime.begin() + bound(c + 1), -1);
+    });
+    const std::vector<long long> idleFrom = idleBefore(maps);
+
+    // Pass 2: busy periods per chunk, and the first one opening in each chunk
+    std::vector<size_t> periods(chunks, 0), firstOpen(chunks, n);
+    pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+        long long e = idleFrom[c];
+        for (size_t i = bound(c); i < bound(c + 1); ++i) {
+            int job = order[i];
+            if (i == 0 || e < arrival[job]) {
+                if (periods[c]++ == 0) firstOpen[c] = i;
+            }
+            e = std::max(e, static_cast<long long>(arrival[job])) + burst[job];
+        }
+    });
+
+    // Segments run from each chunk's first boundary to the next chunk's
+    std::vector<size_t> cuts;
+    for (size_t c = 0; c < chunks; ++c) {
+        if (firstOpen[c] != n) cuts.push_back(firstOpen[c]);
+    }
+    cuts.push_back(n);
+
+    std::vector<Simulator<Policy>> simulators(pool.threadCount());
+    pool.run(cuts.size() - 1, [&](size_t s, unsigned worker) {
+        WorkloadJobs jobs(w, order.data() + cuts[s], cuts[s + 1] - cuts[s]);
+        simulators[worker].run(jobs);
+    });
+    return std::accumulate(periods.begin(), periods.end(), size_t(0));
+}
@@ -0,0 +1,414 @@
+// Discrete-event simulation core shared by geminiversion.cpp and
+// SchedulingAlgorithms.cpp, running on the structure-of-arrays Workload.
+// Instead of advancing the clock one tick at a time, time jumps straight to the
+// next arrival or completion, so the cost of a run depends on the number of
+// events rather than on the total simulated CPU time.
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "ReadyQueue.h"
+#include "SchedTrace.h"
+#include "Workload.h"
+
+// --- Ready Queue Ordering ---
+// Which ready job is dispatched next. Ties always go to the lower job index,
+// which matches the id tie-break used by the original tick loops.
+enum class QueueKey {
+    Arrival,      // Earliest arrival time (FIFO in geminiversion.cpp)
+    Index,        // Lowest job index among arrived jobs (FIFO in SchedulingAlgorithms.cpp)
+    TotalCpu,     // Shortest original burst (SJF)
+    RemainingCpu  // Shortest remaining burst (SRT)
+};
+
+// --- Arrival Order ---
+// Job indices sorted by (arrival time, index)
+inline void sortArrivalOrder(const std::vector<int>& arrival, std::vector<int>& order) {
+    order.resize(arrival.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        if (arrival[a] != arrival[b]) {
+            return arrival[a] < arrival[b];
+        }
+        return a < b; // Tie-breaker
+    });
+}
+
+// --- Arrival Index ---
+// Job indices sorted once by (arrival time, index), plus a cursor that only
+// moves forward. Admitting arrivals and finding the next arrival time are
+// amortized O(1) instead of a scan over every job. The order can live in a
+// caller's buffer, so repeated runs reuse its storage and, over the same
+// arrivals, skip the sort.
+class ArrivalIndex {
+public:
+    explicit ArrivalIndex(const std::vector<int>& arrival) : arrival_(arrival) { build(own_); }
+
+    // Keeps the order in `order`; if `sorted`, it already holds the order of
+    // these arrivals from an earlier index
+    ArrivalIndex(const std::vector<int>& arrival, std::vector<int>& order, bool sorted) : arrival_(arrival) {
+        if (sorted) {
+            order_ = order.data();
+            count_ = order.size();
+        } else {
+            build(order);
+        }
+    }
+
+    // Walks a slice of an order built elsewhere, e.g. one busy period
+    ArrivalIndex(const std::vector<int>& arrival, const int* order, size_t count)
+        : arrival_(arrival), order_(order), count_(count) {}
+
+    ArrivalIndex(const ArrivalIndex&) = delete;
+    ArrivalIndex& operator=(const ArrivalIndex&) = delete;
+
+    // True if the next unadmitted job has arrived by time t
+    bool hasArrivedBy(long long t) const {
+        return cursor_ < count_ && arrival_[order_[cursor_]] <= t;
+    }
+
+    // Index of the next job in arrival order; advances the cursor
+    int next() { return order_[cursor_++]; }
+
+    // Arrival time of the next unadmitted job, or max() if all were admitted
+    long long nextArrivalTime() const {
+        return cursor_ < count_ ? arrival_[order_[cursor_]]
+                                : std::numeric_limits<long long>::max();
+    }
+
+private:
+    void build(std::vector<int>& order) {
+        sortArrivalOrder(arrival_, order);
+        order_ = order.data();
+        count_ = order.size();
+    }
+
+    const std::vector<int>& arrival_;
+    std::vector<int> own_;        // Order storage unless the caller provides it
+    const int* order_ = nullptr;
+    size_t count_ = 0;
+    size_t cursor_ = 0;
+};
+
+// --- Job Stores ---
+// The engine reaches jobs only through a store, which hands out arrivals in
+// (arrival, id) order and owns the per-job state, addressed by slot:
+//   bool hasArrivedBy(long long t) const;  // next unadmitted job arrived by t?
+//   long long nextArrivalTime() const;     // max() once every job was admitted
+//   int admit();                           // slot of the next arrival
+//   int id(int slot) const;                // tie-breaker
+//   long long arrival(int slot) const;
+//   int burst(int slot) const;
+//   int& remaining(int slot);
+//   void complete(int slot, long long time);
+// Optionally a store may also define
+//   void dispatch(int slot, long long time); // job put on the CPU
+// which the simulators call only when it exists (see MeteredJobs).
+// WorkloadJobs below keeps everything in a Workload (slot == job index);
+// OnlineScheduler.h keeps submitted jobs in a pool of recycled slots.
+
+class WorkloadJobs {
+public:
+    explicit WorkloadJobs(Workload& w) : w_(w), arrivals_(w.arrivalTime) {}
+
+    // Keeps the arrival order in a reusable buffer (see ArrivalIndex)
+    WorkloadJobs(Workload& w, std::vector<int>& order, bool sorted) : w_(w), arrivals_(w.arrivalTime, order, sorted) {}
+
+    // Only the jobs order[0 .. count), already in arrival order
+    WorkloadJobs(Workload& w, const int* order, size_t count) : w_(w), arrivals_(w.arrivalTime, order, count) {}
+
+    bool hasArrivedBy(long long t) const { return arrivals_.hasArrivedBy(t); }
+    long long nextArrivalTime() const { return arrivals_.nextArrivalTime(); }
+    int admit() { return arrivals_.next(); }
+
+    int id(int slot) const { return slot; }
+    long long arrival(int slot) const { return w_.arrivalTime[slot]; }
+    int burst(int slot) const { return w_.totalCpuTime[slot]; }
+    int& remaining(int slot) { return w_.remainingCpuTime[slot]; }
+    void complete(int slot, long long time) { w_.completionTime[slot] = time; }
+
+private:
+    Workload& w_;
+    ArrivalIndex arrivals_;
+};
+
+// True if Jobs has the optional dispatch(slot, time) hook
+template <typename Jobs, typename = void>
+struct HasDispatchHook : std::false_type {};
+template <typename Jobs>
+struct HasDispatchHook<Jobs, std::void_t<decltype(std::declval<Jobs&>().dispatch(0, 0LL))>> : std::true_type {};
+
+// --- Latency Metrics ---
+// Response time is the wait from arrival to the first dispatch. A context
+// switch is the CPU going from one job straight to a different one, either
+// because the first was preempted or its slice ran out, or because it
+// completed with another job ready; dispatching onto an idle CPU is not one.
+struct LatencyStats {
+    size_t responded = 0;          // Jobs dispatched at least once
+    double totalResponseTime = 0;
+    long long maxResponseTime = 0;
+    size_t contextSwitches = 0;
+
+    double averageResponse() const { return responded > 0 ? totalResponseTime / responded : 0.0; }
+};
+
+// Wraps another store and measures LatencyStats through the dispatch hook;
+// everything else is forwarded unchanged, so results match the bare store.
+template <typename Jobs>
+class MeteredJobs {
+public:
+    explicit MeteredJobs(Jobs& jobs) : jobs_(jobs) {}
+
+    bool hasArrivedBy(long long t) const { return jobs_.hasArrivedBy(t); }
+    long long nextArrivalTime() const { return jobs_.nextArrivalTime(); }
+
+    int admit() {
+        int slot = jobs_.admit();
+        if (slot >= static_cast<int>(dispatched_.size())) dispatched_.resize(slot + 1);
+        dispatched_[slot] = false; // Streamed stores recycle slots
+        return slot;
+    }
+
+    int id(int slot) const { return jobs_.id(slot); }
+    long long arrival(int slot) const { return jobs_.arrival(slot); }
+    int burst(int slot) const { return jobs_.burst(slot); }
+    int& remaining(int slot) { return jobs_.remaining(slot); }
+
+    void complete(int slot, long long time) {
+        jobs_.complete(slot, time);
+        lastDone_ = true;
+        lastDoneTime_ = time;
+    }
+
+    void dispatch(int slot, long long time) {
+        if (!dispatched_[slot]) {
+            long long response = time - jobs_.arrival(slot);
+            dispatched_[slot] = true;
+            stats_.responded++;
+            stats_.totalResponseTime += response;
+            if (response > stats_.maxResponseTime) stats_.maxResponseTime = response;
+        }
+        if (lastSlot_ != -1 && (lastDone_ ? lastDoneTime_ == time : slot != lastSlot_)) {
+            stats_.contextSwitches++;
+        }
+        lastSlot_ = slot;
+        lastDone_ = false;
+    }
+
+    const LatencyStats& stats() const { return stats_; }
+
+private:
+    Jobs& jobs_;
+    std::vector<char> dispatched_; // Indexed by slot
+    LatencyStats stats_;
+    int lastSlot_ = -1;            // Last job dispatched
+    bool lastDone_ = false;        // Whether it has completed since
+    long long lastDoneTime_ = 0;
+};
+
+// --- Scheduling Policies ---
+// Simulator<Policy> takes the scheduling rule as a traits type:
+//   using Queue = ...;                 // ready queue from ReadyQueue.h
+//   static constexpr bool preemptive;  // re-check the running job on arrivals
+//   template <typename Jobs> static long long key(Jobs& jobs, int slot);
+//                                      // smaller key runs first
+//   template <typename Jobs> static int tieBreak(Jobs& jobs, int slot);
+//                                      // among equal keys, smaller runs first
+// The compiler sees the whole rule, so every policy gets its own inlined hot
+// loop with no per-event checks of which algorithm is running. A new policy
+// is a new traits struct; KeyPolicy covers the orderings of QueueKey.
+template <QueueKey Key, bool Preemptive>
+struct KeyPolicy {
+    // Arrival order never reorders, so FIFO can use the O(1) ring buffer
+    using Queue = typename std::conditional<Key == QueueKey::Arrival && !Preemptive,
+                                            FifoReadyQueue, MinHeapReadyQueue>::type;
+    static constexpr bool preemptive = Preemptive;
+
+    template <typename Jobs>
+    static long long key(Jobs& jobs, int slot) {
+        if constexpr (Key == QueueKey::Arrival) return jobs.arrival(slot);
+        else if constexpr (Key == QueueKey::Index) return jobs.id(slot);
+        else if constexpr (Key == QueueKey::TotalCpu) return jobs.burst(slot);
+        else return jobs.remaining(slot);
+    }
+
+    template <typename Jobs>
+    static int tieBreak(Jobs& jobs, int slot) { return jobs.id(slot); }
+};
+
+using FifoPolicy = KeyPolicy<QueueKey::Arrival, false>;     // FIFO in geminiversion.cpp
+using IndexOrderPolicy = KeyPolicy<QueueKey::Index, false>; // FIFO in SchedulingAlgorithms.cpp
+using SjfPolicy = KeyPolicy<QueueKey::TotalCpu, false>;
+using SrtPolicy = KeyPolicy<QueueKey::RemainingCpu, true>;
+
+// --- Event-Driven Simulation ---
+// Runs one schedule over the jobs of a store, reporting each completion
+// through jobs.complete(). Jobs are pushed into the ready queue in
+// (arrival, id) order, so a FIFO ring is enough when ordering by arrival.
+// For preemptive policies the running job is compared against the ready
+// queue only when new jobs arrive: between arrivals its remaining time only
+// shrinks, so it stays the best candidate until then.
+//
+// The simulation is resumable: begin() resets it and advance(jobs, limit)
+// applies every event before limit plus completions at limit, then parks the
+// clock at limit. Arrivals at limit, and the dispatches they take part in,
+// are left to the next call, so jobs may be added to the store between calls
+// as long as they arrive at or after the clock. OnlineScheduler.h drives it
+// this way; run() is the batch case, begin() plus one advance() to the end.
+// The ready queue is kept between runs, so a reused Simulator does not
+// reallocate it.
+template <typename Policy>
+class Simulator {
+public:
+    explicit Simulator(Policy policy = Policy()) : policy_(policy) {}
+
+    void begin() {
+        SCHED_TRACE_RUN();
+        running_ = -1;
+        currentTime_ = 0;
+        readyQueue_.clear();
+    }
+
+    template <typename Jobs>
+    void advance(Jobs& jobs, long long limit) {
+        const long long never = std::numeric_limits<long long>::max();
+        if (limit <= currentTime_) return;
+        int running = running_; // Slot of the job on the CPU, -1 if idle
+        long long currentTime = currentTime_;
+
+        auto entryOf = [&](int slot) {
+            return ReadyEntry{policy_.key(jobs, slot), policy_.tieBreak(jobs, slot), slot};
+        };
+
+        for (;;) {
+            // 1. Admit every job that has arrived by now
+            bool arrivedNow = false;
+            while (jobs.hasArrivedBy(currentTime)) {
+                int slot = jobs.admit();
+                SCHED_TRACE(Arrival, jobs.arrival(slot), jobs.id(slot), 0);
+                readyQueue_.push(entryOf(slot));
+                arrivedNow = true;
+            }
+
+            // 2. Preemption check: only an arrival can displace the running job
+            if (policy_.preemptive && arrivedNow && running != -1 && readyQueue_.top() < entryOf(running)) {
+                SCHED_TRACE(Preempt, currentTime, jobs.id(running), 0);
+                readyQueue_.push(entryOf(running));
+                running = -1;
+            }
+
+            // 3. Dispatch, or jump straight to the next arrival if nothing is ready
+            if (running == -1) {
+                if (readyQueue_.empty()) {
+                    long long nextArrival = jobs.nextArrivalTime();
+                    if (nextArrival >= limit) { // All jobs done, or none before the limit
+                        if (limit != never) currentTime = limit;
+                        break;
+                    }
+                    currentTime = nextArrival;
+                    continue;
+                }
+                running = readyQueue_.pop().slot;
+                SCHED_TRACE(Dispatch, currentTime, jobs.id(running), 0);
+                if constexpr (HasDispatchHook<Jobs>::value) jobs.dispatch(running, currentTime);
+            }
+
+            // 4. Advance to the next event: an arrival that may preempt, or
+            // completion. A job finishing at the limit completes in this call,
+            // even if a job also arrives then.
+            int& remaining = jobs.remaining(running);
+            long long finishTime = currentTime + remaining;
+            long long nextArrival = policy_.preemptive ? jobs.nextArrivalTime() : never;
+            if (finishTime > limit && nextArrival >= limit) {
+                remaining -= static_cast<int>(limit - currentTime); // Still running at the limit
+                currentTime = limit;
+                break;
+            }
+            if (nextArrival < finishTime) {
+                remaining -= static_cast<int>(nextArrival - currentTime);
+                currentTime = nextArrival;
+            } else {
+                currentTime = finishTime;
+                remaining = 0;
+                SCHED_TRACE(Complete, currentTime, jobs.id(running), 0);
+                jobs.complete(running, currentTime);
+                running = -1;
+                if (currentTime == limit) break;
+            }
+        }
+
+        running_ = running;
+        currentTime_ = currentTime;
+    }
+
+    template <typename Jobs>
+    void run(Jobs& jobs) {
+        begin();
+        advance(jobs, std::numeric_limits<long long>::max());
+    }
+
+    // Simulates a whole workload, filling in remainingCpuTime and completionTime
+    void run(Workload& w) {
+        w.reset();
+        WorkloadJobs jobs(w);
+        run(jobs);
+    }
+
+    long long now() const { return currentTime_; }
+    int running() const { return running_; }    // Slot on the CPU, -1 if idle
+    bool hasReady() const { return !readyQueue_.empty(); }
+
+    // Sizes the ready queue for up to `jobs` waiting jobs
+    void reserve(size_t jobs) { readyQueue_.reserve(jobs); }
+
+private:
+    Policy policy_;
+    typename Policy::Queue readyQueue_;
+    int running_ = -1;
+    long long currentTime_ = 0;
+};
+
+// Calls fn(policy) with the KeyPolicy for a runtime (key, preemptive) pair,
+// so data-driven callers still get a specialized simulator
+template <typename Fn>
+void withKeyPolicy(QueueKey key, bool preemptive, Fn&& fn) {
+    switch (key) {
+        case QueueKey::Arrival:
+            if (preemptive) fn(KeyPolicy<QueueKey::Arrival, true>());
+            else fn(KeyPolicy<QueueKey::Arrival, false>());
+            return;
+        case QueueKey::Index:
+            if (preemptive) fn(KeyPolicy<QueueKey::Index, true>());
+            else fn(KeyPolicy<QueueKey::Index, false>());
+            return;
+        case QueueKey::TotalCpu:
+            if (preemptive) fn(KeyPolicy<QueueKey::TotalCpu, true>());
+            else fn(KeyPolicy<QueueKey::TotalCpu, false>());
+            return;
+        case QueueKey::RemainingCpu:
+            if (preemptive) fn(KeyPolicy<QueueKey::RemainingCpu, true>());
+            else fn(KeyPolicy<QueueKey::RemainingCpu, false>());
+            return;
+    }
+}
+
+// Runtime selection of one of the KeyPolicy simulators, for callers that
+// choose the ordering from data (multi-core runs, benchmarks, ...)
+template <typename Jobs>
+void runEvents(Jobs& jobs, QueueKey key, bool preemptive) {
+    withKeyPolicy(key, preemptive, [&](auto policy) { Simulator<decltype(policy)>(policy).run(jobs); });
+}
+
+// Runs one schedule over the workload, filling in remainingCpuTime and
+// completionTime for every job. Only arrivalTime and totalCpuTime are read, so
+// the same workload can be simulated again after another policy ran on it.
+inline void runEventSimulation(Workload& w, QueueKey key, bool preemptive) {
+    w.reset();
+    WorkloadJobs jobs(w);
+    runEvents(jobs, key, preemptive);
+}
@@ -0,0 +1,117 @@
+// Closed-form FIFO. Jobs run to completion in (arrival, index) order, so
+// their completion times follow the prefix recurrence
+//   C_i = max(C_{i-1}, a_i) + b_i
+// and need no event loop and no ready queue. The jobs are put in arrival order
+// by the radix sort of BusyPeriods.h, and each chunk of that order is scanned
+// with the vectorized fifoCompletionScan() from SimdKernels.h. Chunks run in
+// parallel: a first pass folds every chunk into its IdleMap, a sequential pass
+// over the chunks gives each one the time the CPU frees up before it, and a
+// second pass writes the completion times. Small workloads skip all of that
+// (see kFifoScanSerialCutoff). The results are exactly those of
+// Simulator<FifoPolicy>; Benchmark --check-fifo compares them.
+//
+//   WorkStealingPool pool;
+//   runFifoScan(workload, pool);              // or runFifoScan(workload)
+//   double att = reduceTurnaround(workload).mean;
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+#include "BusyPeriods.h"
+#include "EventEngine.h"
+#include "SimdKernels.h"
+#include "SweepRunner.h"
+#include "Workload.h"
+
+// --- FIFO Over an Order ---
+// Runs jobs to completion in arrival order on a CPU that is free from
+// `carry` and returns when it is free again. The jobs are given by their
+// arrivals a, bursts b and indices order, all in that order; if w is given,
+// each job's completion time is written back to it. The scan writes into a
+// small tile first, so a measuring pass touches no memory of its own.
+inline long long fifoCompleteInOrder(const int* a, const int* b, const int* order, size_t count, long long carry,
+                                     Workload* w) {
+    constexpr size_t kTile = 512;
+    long long c[kTile];
+    for (size_t first = 0; first < count; first += kTile) {
+        const size_t len = std::min(kTile, count - first);
+        carry = fifoCompletionScan(a + first, b + first, c, len, carry);
+        if (w) {
+            for (size_t j = 0; j < len; ++j) w->completionTime[order[first + j]] = c[j];
+        }
+    }
+    return carry;
+}
+
+// Same for jobs known only by their indices, gathered a tile at a time, e.g.
+// over the order an ArrivalIndex already built. Also sets their remaining
+// times to 0.
+inline long long fifoCompleteInOrder(Workload& w, const int* order, size_t count, long long carry) {
+    constexpr size_t kTile = 512;
+    int a[kTile], b[kTile];
+    for (size_t first = 0; first < count; first += kTile) {
+        const size_t len = std::min(kTile, count - first);
+        for (size_t j = 0; j < len; ++j) {
+            a[j] = w.arrivalTime[order[first + j]];
+            b[j] = w.totalCpuTime[order[first + j]];
+            w.remainingCpuTime[order[first + j]] = 0;
+        }
+        carry = fifoCompleteInOrder(a, b, order + first, len, carry, &w);
+    }
+    return carry;
+}
+
+// --- Closed-Form FIFO Run ---
+// Below this many jobs the radix sort, chunk maps and pool tasks cost more
+// than they save, and runFifoScan() sorts with sortArrivalOrder() and scans
+// on the calling thread instead, as SimulationContext does.
+constexpr size_t kFifoScanSerialCutoff = 2048;
+
+// Fills in remainingCpuTime and completionTime for every job, like
+// Simulator<FifoPolicy>().run(w). `chunks` sets the parallel grain (default:
+// 4 per thread).
+inline void runFifoScan(Workload& w, WorkStealingPool& pool, size_t chunks = 0) {
+    const size_t n = w.size();
+    if (n == 0) return;
+    if (n < kFifoScanSerialCutoff) {
+        std::vector<int> order;
+        sortArrivalOrder(w.arrivalTime, order);
+        fifoCompleteInOrder(w, order.data(), order.size(), 0);
+        return;
+    }
+    if (chunks == 0) chunks = 4 * static_cast<size_t>(pool.threadCount());
+    chunks = std::max<size_t>(1, std::min(chunks, n));
+    const size_t chunkSize = (n + chunks - 1) / chunks;
+    chunks = (n + chunkSize - 1) / chunkSize;
+    auto bound = [&](size_t c) { return std::min(n, c * chunkSize); };
+
+    std::vector<int> order;
+    SortedJobs jobs;
+    sortByArrival(w, order, pool, chunks, &jobs);
+    auto scan = [&](size_t c, long long carry, Workload* out) {
+        return fifoCompleteInOrder(jobs.arrival.data() + bound(c), jobs.burst.data() + bound(c),
+                                   order.data() + bound(c), bound(c + 1) - bound(c), carry, out);
+    };
+
+    std::vector<IdleMap> maps(chunks);
+    if (chunks > 1) {
+        pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+            for (size_t i = bound(c); i < bound(c + 1); ++i) maps[c].B += jobs.burst[i];
+            maps[c].A = scan(c, std::numeric_limits<long long>::min(), nullptr);
+        });
+    }
+    const std::vector<long long> idleFrom = idleBefore(maps);
+    pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+        scan(c, idleFrom[c], &w);
+        std::fill(w.remainingCpuTime.begin() + bound(c), w.remainingCpuTime.begin() + bound(c + 1), 0);
+    });
+}
+
+// Single-threaded run on the calling thread
+inline void runFifoScan(Workload& w) {
+    WorkStealingPool serial(1);
+    runFifoScan(w, serial, 1);
+}
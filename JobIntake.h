@@ -0,0 +1,122 @@
+// Lock-free job intake for a live scheduler fed by many threads. Producers
+// push jobs into a bounded multi-producer / single-consumer ring; the one
+// scheduling thread drains it in batches into an OnlineScheduler, whose ready
+// queue (FIFO ring or heap, see ReadyQueue.h) stays single-threaded.
+//
+// The ring is the bounded array queue with per-cell sequence numbers: a
+// producer claims a cell with one compare-and-swap on the tail and publishes
+// it by bumping the cell's sequence, so producers never wait on each other
+// except to retry a lost CAS, and the consumer reads without any atomic
+// read-modify-write. Capacity is fixed at construction, so pushing never
+// allocates; a full ring makes tryPush() fail and push() back off.
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+
+#include "OnlineScheduler.h"
+#include "TraceReader.h"
+
+// --- MPSC Ring ---
+template <typename T>
+class MpscRing {
+public:
+    // Capacity is rounded up to a power of two
+    explicit MpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size *= 2;
+        mask_ = size - 1;
+        cells_.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // Any thread. False if the ring is full.
+    bool tryPush(const T& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t lag = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (lag == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false; // The consumer has not freed this cell yet
+            } else {
+                pos = tail_.load(std::memory_order_relaxed); // Another producer took it
+            }
+        }
+    }
+
+    // Any thread. Yields until there is room; returns how often it had to.
+    size_t push(const T& value) {
+        size_t waits = 0;
+        while (!tryPush(value)) {
+            waits++;
+            std::this_thread::yield();
+        }
+        return waits;
+    }
+
+    // Consumer thread only. Calls fn(value) for up to maxItems published
+    // values in push order and returns how many it took.
+    template <typename Fn>
+    size_t drain(Fn&& fn, size_t maxItems) {
+        size_t taken = 0;
+        while (taken < maxItems) {
+            Cell& cell = cells_[head_ & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) break; // Not published yet
+            fn(cell.value);
+            cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+            head_++;
+            taken++;
+        }
+        return taken;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> tail_{0}; // Next cell producers claim
+    alignas(64) size_t head_ = 0;             // Next cell the consumer reads
+};
+
+// --- Scheduler Intake ---
+// Producers only know a job's id and burst; the job arrives when the
+// scheduling thread takes it in, so JobRecord::arrival is ignored.
+using JobIntake = MpscRing<JobRecord>;
+
+// Moves up to maxBatch jobs from the intake into the scheduler, stamping each
+// with the scheduler's clock as its arrival time, and returns how many it took
+// off the ring. A job submit() refuses (because a job submitted directly was
+// stamped later than the clock) is dropped and added to *rejected if given.
+// Call from the scheduling thread between tickUntil() calls.
+template <typename Policy>
+size_t admitFromIntake(JobIntake& intake, OnlineScheduler<Policy>& scheduler, size_t maxBatch,
+                       size_t* rejected = nullptr) {
+    const long long now = scheduler.now();
+    size_t refused = 0;
+    size_t taken = intake.drain(
+        [&](const JobRecord& job) {
+            if (!scheduler.submit(job.id, now, job.burst)) refused++;
+        },
+        maxBatch);
+    if (rejected) *rejected += refused;
+    return taken;
+}
@@ -0,0 +1,99 @@
+// Constant-memory latency distributions for the simulators. Values are
+// counted in an HDR-style log-linear histogram: exact below 256, and above
+// that 128 linear sub-buckets per power of two, so any reported percentile is
+// within 1/128 (< 0.8%) of the true value. The whole 64-bit range fits in a
+// fixed 7424-counter table (58 KB), whatever the number of jobs, so tails of
+// 10^8-job runs cost no more memory than tails of 50 jobs.
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+// --- Streaming Histogram ---
+class StreamingHistogram {
+public:
+    StreamingHistogram() : counts_(kBuckets, 0) {}
+
+    void record(uint64_t value) {
+        counts_[indexOf(value)]++;
+        count_++;
+        if (value > max_) max_ = value;
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t max() const { return max_; }
+
+    // Nearest-rank percentile (0 < p <= 100), reported as the largest value
+    // that shares its bucket, capped at the largest value recorded
+    uint64_t percentile(double p) const {
+        if (count_ == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(count_)));
+        rank = std::min(std::max<uint64_t>(rank, 1), count_);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) return std::min(highestInBucket(i), max_);
+        }
+        return max_;
+    }
+
+    void merge(const StreamingHistogram& other) {
+        for (size_t i = 0; i < kBuckets; ++i) counts_[i] += other.counts_[i];
+        count_ += other.count_;
+        max_ = std::max(max_, other.max_);
+    }
+
+    void clear() {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        count_ = 0;
+        max_ = 0;
+    }
+
+private:
+    static constexpr int kSubBits = 7;                  // 128 sub-buckets per power of two
+    static constexpr uint64_t kLinear = 2u << kSubBits; // Values below this are exact
+    static constexpr size_t kBuckets = kLinear + (63 - kSubBits) * (size_t(1) << kSubBits);
+
+    static size_t indexOf(uint64_t value) {
+        if (value < kLinear) return static_cast<size_t>(value);
+        int shift = 63 - __builtin_clzll(value) - kSubBits; // >= 1
+        uint64_t top = value >> shift;                       // In [128, 256)
+        return static_cast<size_t>(kLinear + (shift - 1) * (uint64_t(1) << kSubBits) + (top - (uint64_t(1) << kSubBits)));
+    }
+
+    static uint64_t highestInBucket(size_t index) {
+        if (index < kLinear) return index;
+        size_t offset = index - kLinear;
+        int shift = static_cast<int>(offset >> kSubBits) + 1;
+        uint64_t top = (offset & ((size_t(1) << kSubBits) - 1)) + (uint64_t(1) << kSubBits);
+        return (top << shift) | ((uint64_t(1) << shift) - 1);
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t count_ = 0;
+    uint64_t max_ = 0;
+};
+
+// --- Per-Job Latency Metrics ---
+// Turnaround = completion - arrival, waiting = turnaround - burst and
+// slowdown = turnaround / burst, recorded one job at a time as jobs complete.
+// Slowdown is kept in fixed point with kSlowdownScale steps per unit.
+struct LatencyDistribution {
+    static constexpr double kSlowdownScale = 1000.0;
+
+    StreamingHistogram turnaround;
+    StreamingHistogram waiting;
+    StreamingHistogram slowdown;
+
+    void record(long long arrival, int burst, long long completion) {
+        long long tt = completion - arrival;
+        turnaround.record(static_cast<uint64_t>(std::max(0LL, tt)));
+        waiting.record(static_cast<uint64_t>(std::max(0LL, tt - burst)));
+        slowdown.record(static_cast<uint64_t>(std::llround(kSlowdownScale * tt / std::max(1, burst))));
+    }
+
+    double slowdownPercentile(double p) const { return slowdown.percentile(p) / kSlowdownScale; }
+};
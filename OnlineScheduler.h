@@ -0,0 +1,219 @@
+// Incremental (online) front end to the event engine, for running the same
+// policies inside a live dispatcher instead of over a finished job list.
+//
+//   OnlineScheduler<SrtPolicy> scheduler;
+//   scheduler.submit(id, arrival, burst);   // as jobs show up
+//   scheduler.tickUntil(now);               // apply the events up to now
+//   while (scheduler.nextDispatch(d)) ...   // decisions made meanwhile
+//   while (scheduler.nextCompletion(c)) ...
+//
+// State lives across calls: the clock, the job on the CPU, the ready queue
+// and the jobs not yet arrived. Jobs occupy pooled nodes that are recycled on
+// completion, and events are buffered in reusable storage, so once the pools
+// have grown to the peak number of live jobs and the longest backlog between
+// reads, no call allocates. A tickUntil() costs O(log n) per event it applies;
+// to bound the latency of one call, tick in shorter steps.
+//
+// The batch simulators are the same engine: Simulator<Policy>::run() is one
+// advance() to the end, and simulateTrace() in TraceReader.h replays a trace
+// through an OnlineScheduler.
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <iostream>
+#include <algorithm>
+#include <cstddef>
+
+#include "EventEngine.h"
+#include "ReadyQueue.h"
+
+// --- Scheduler Events ---
+struct DispatchEvent {
+    int id;         // Job put on the CPU
+    long long time;
+};
+
+struct CompletionEvent {
+    int id;
+    int burst;
+    long long arrival;
+    long long time; // Completion time
+};
+
+// --- Event Buffer ---
+// FIFO that keeps its storage: draining it resets it in place and a partly
+// read buffer is compacted before it would grow, so it stops allocating once
+// it has reached the largest backlog between reads.
+template <typename Event>
+class EventBuffer {
+public:
+    void push(const Event& event) {
+        if (head_ > 0 && events_.size() == events_.capacity()) {
+            events_.erase(events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(head_));
+            head_ = 0;
+        }
+        events_.push_back(event);
+    }
+
+    // Removes the oldest event into event; false if there is none
+    bool pop(Event& event) {
+        if (head_ == events_.size()) return false;
+        event = events_[head_++];
+        if (head_ == events_.size()) clear();
+        return true;
+    }
+
+    size_t size() const { return events_.size() - head_; }
+    void clear() {
+        events_.clear();
+        head_ = 0;
+    }
+
+private:
+    std::vector<Event> events_;
+    size_t head_ = 0;
+};
+
+// --- Online Scheduler ---
+template <typename Policy>
+class OnlineScheduler {
+public:
+    explicit OnlineScheduler(Policy policy = Policy()) : simulator_(policy) { simulator_.begin(); }
+
+    // Queues a job. Arrivals must be in non-decreasing order and not before
+    // the clock, and bursts at least 1; a job that breaks this is rejected.
+    // Jobs arriving at the same time may come in any id order: they are
+    // admitted by (arrival, id), as in the batch engine.
+    bool submit(int id, long long arrival, int burst) {
+        if (arrival < simulator_.now() || arrival < jobs_.lastArrival()) {
+            std::cerr << "Error: job " << id << " arrives at " << arrival
+                      << ", before the clock or an earlier job" << std::endl;
+            return false;
+        }
+        if (burst < 1) {
+            std::cerr << "Error: job " << id << " has burst " << burst << ", expected at least 1" << std::endl;
+            return false;
+        }
+        jobs_.add(id, arrival, burst);
+        return true;
+    }
+
+    // Applies every arrival, dispatch and completion before t, plus
+    // completions at t, and moves the clock to t. Arrivals at t and the
+    // dispatch decisions they take part in wait for a later call, so jobs
+    // arriving at t can still be submitted.
+    void tickUntil(long long t) { simulator_.advance(jobs_, t); }
+
+    // Runs every submitted job to completion
+    void finish() { simulator_.advance(jobs_, std::numeric_limits<long long>::max()); }
+
+    // Oldest dispatch / completion not read yet; false if there is none
+    bool nextDispatch(DispatchEvent& event) { return jobs_.dispatches.pop(event); }
+    bool nextCompletion(CompletionEvent& event) { return jobs_.completions.pop(event); }
+
+    long long now() const { return simulator_.now(); }
+
+    // Job id on the CPU, -1 if idle
+    int running() const { return simulator_.running() == -1 ? -1 : jobs_.id(simulator_.running()); }
+
+    // Time of the next event given the jobs submitted so far: the next arrival
+    // or the running job's completion; max() if there is nothing left to do
+    long long nextEventTime() const {
+        long long t = jobs_.nextArrivalTime();
+        int slot = simulator_.running();
+        if (slot != -1) t = std::min(t, simulator_.now() + jobs_.remainingOf(slot));
+        return t;
+    }
+
+    size_t liveJobs() const { return jobs_.live(); } // Arrived and not completed
+    size_t peakLive() const { return jobs_.peakLive(); }
+
+    // Forgets every job and event and restarts the clock at 0, keeping the pools
+    void reset() {
+        simulator_.begin();
+        jobs_.clear();
+    }
+
+private:
+    // Job store for the simulator (see EventEngine.h), with nodes addressed by
+    // slot and recycled through a free list
+    class JobPool {
+    public:
+        EventBuffer<DispatchEvent> dispatches;
+        EventBuffer<CompletionEvent> completions;
+
+        void add(int id, long long arrival, int burst) {
+            int slot;
+            if (!freeSlots_.empty()) {
+                slot = freeSlots_.back();
+                freeSlots_.pop_back();
+            } else {
+                slot = static_cast<int>(nodes_.size());
+                nodes_.emplace_back();
+                remaining_.emplace_back();
+            }
+            nodes_[slot] = JobNode{id, burst, arrival};
+            remaining_[slot] = burst;
+            pending_.push(ReadyEntry{arrival, id, slot});
+            lastArrival_ = arrival;
+        }
+
+        bool hasArrivedBy(long long t) const { return !pending_.empty() && pending_.top().key <= t; }
+        long long nextArrivalTime() const {
+            return pending_.empty() ? std::numeric_limits<long long>::max() : pending_.top().key;
+        }
+        int admit() {
+            live_++;
+            if (live_ > peakLive_) peakLive_ = live_;
+            return pending_.pop().slot;
+        }
+
+        int id(int slot) const { return nodes_[slot].id; }
+        long long arrival(int slot) const { return nodes_[slot].arrival; }
+        int burst(int slot) const { return nodes_[slot].burst; }
+        int& remaining(int slot) { return remaining_[slot]; }
+        int remainingOf(int slot) const { return remaining_[slot]; }
+
+        void dispatch(int slot, long long time) { dispatches.push(DispatchEvent{nodes_[slot].id, time}); }
+
+        void complete(int slot, long long time) {
+            completions.push(CompletionEvent{nodes_[slot].id, nodes_[slot].burst, nodes_[slot].arrival, time});
+            freeSlots_.push_back(slot);
+            live_--;
+        }
+
+        long long lastArrival() const { return lastArrival_; }
+        size_t live() const { return live_; }
+        size_t peakLive() const { return peakLive_; }
+
+        void clear() {
+            freeSlots_.clear();
+            for (int slot = static_cast<int>(nodes_.size()) - 1; slot >= 0; --slot) freeSlots_.push_back(slot);
+            pending_.clear();
+            dispatches.clear();
+            completions.clear();
+            lastArrival_ = std::numeric_limits<long long>::min();
+            live_ = 0;
+            peakLive_ = 0;
+        }
+
+    private:
+        struct JobNode {
+            int id;
+            int burst;
+            long long arrival;
+        };
+
+        std::vector<JobNode> nodes_;  // Indexed by slot
+        std::vector<int> remaining_;  // Indexed by slot
+        std::vector<int> freeSlots_;
+        MinHeapReadyQueue pending_;   // Submitted, not yet arrived, by (arrival, id)
+        long long lastArrival_ = std::numeric_limits<long long>::min();
+        size_t live_ = 0;
+        size_t peakLive_ = 0;
+    };
+
+    Simulator<Policy> simulator_;
+    JobPool jobs_;
+};
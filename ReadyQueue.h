@@ -0,0 +1,110 @@
+// Ready queues for the event engine (EventEngine.h). Every queue stores
+// (key, id, slot) entries by value, hands out the smallest key first and breaks ties
+// on the lower id, the same ordering the original Process::compareTotalCpuTime
+// and Process::compareRemainingCpuTime comparators used.
+//
+// Interface shared by all queues:
+//   void push(ReadyEntry entry);
+//   ReadyEntry top() const;   // smallest (key, id), queue must not be empty
+//   ReadyEntry pop();         // removes and returns top()
+//   bool empty() const;  size_t size() const;  void clear();
+//   void reserve(size_t n);   // room for n entries without reallocating
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+// --- Queue Entry ---
+struct ReadyEntry {
+    long long key; // Ordering key (arrival, burst, remaining time, ...)
+    int id;        // Job id, used as tie-breaker
+    int slot;      // Where the job store keeps the job's state
+
+    bool operator<(const ReadyEntry& other) const {
+        if (key != other.key) {
+            return key < other.key;
+        }
+        return id < other.id; // Tie-breaker
+    }
+};
+
+// --- FIFO Ring Buffer ---
+// O(1) push/pop. Only valid when entries are pushed in non-decreasing
+// (key, id) order, e.g. jobs admitted in arrival order for FIFO scheduling.
+class FifoReadyQueue {
+public:
+    void push(ReadyEntry entry) {
+        if (count_ == buffer_.size()) grow();
+        buffer_[(head_ + count_) & (buffer_.size() - 1)] = entry;
+        count_++;
+    }
+
+    ReadyEntry top() const { return buffer_[head_]; }
+
+    ReadyEntry pop() {
+        ReadyEntry front = buffer_[head_];
+        head_ = (head_ + 1) & (buffer_.size() - 1);
+        count_--;
+        return front;
+    }
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+    void clear() { head_ = 0; count_ = 0; }
+
+    void reserve(size_t n) {
+        size_t capacity = buffer_.empty() ? 16 : buffer_.size();
+        while (capacity < n) capacity *= 2;
+        if (capacity > buffer_.size()) grow(capacity);
+    }
+
+private:
+    // Doubles the capacity (kept a power of two) unless told otherwise and
+    // unwraps the contents
+    void grow(size_t capacity = 0) {
+        if (capacity == 0) capacity = buffer_.empty() ? 16 : buffer_.size() * 2;
+        std::vector<ReadyEntry> bigger(capacity);
+        for (size_t i = 0; i < count_; ++i) {
+            bigger[i] = buffer_[(head_ + i) & (buffer_.size() - 1)];
+        }
+        buffer_.swap(bigger);
+        head_ = 0;
+    }
+
+    std::vector<ReadyEntry> buffer_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+// --- Binary Min-Heap ---
+// O(log n) push/pop on any key: total CPU time for SJF, remaining CPU time
+// for SRT (a preempted job is re-pushed with its updated remaining time, the
+// keys of waiting jobs never change while they wait).
+class MinHeapReadyQueue {
+public:
+    void push(ReadyEntry entry) {
+        heap_.push_back(entry);
+        std::push_heap(heap_.begin(), heap_.end(), greater);
+    }
+
+    ReadyEntry top() const { return heap_.front(); }
+
+    ReadyEntry pop() {
+        std::pop_heap(heap_.begin(), heap_.end(), greater);
+        ReadyEntry front = heap_.back();
+        heap_.pop_back();
+        return front;
+    }
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+    void clear() { heap_.clear(); }
+    void reserve(size_t n) { heap_.reserve(n); }
+
+private:
+    // std::*_heap builds a max-heap, so invert the ordering
+    static bool greater(const ReadyEntry& a, const ReadyEntry& b) { return b < a; }
+
+    std::vector<ReadyEntry> heap_;
+};
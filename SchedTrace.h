@@ -0,0 +1,218 @@
+// Opt-in event tracing for the simulators, exported as a Chrome trace
+// (chrome://tracing or ui.perfetto.dev).
+//
+// Build with -DSCHEDULER_TRACING to enable. The simulators then record every
+// arrival, dispatch, preemption, time-slice expiry and completion as a
+// 16-byte binary event into a ring owned by the recording
+// thread, so threads never contend and the hot loop only stores to memory
+// it already owns. Each ring holds the newest kDefaultTraceCapacity events;
+// older ones are overwritten. exportChromeTrace() writes every ring as JSON
+// after the runs: one process per simulation run, one thread per CPU with a
+// slice for each stretch a job ran, and one async span per job from arrival
+// to completion.
+//
+// Without SCHEDULER_TRACING the SCHED_TRACE* macros expand to nothing and do
+// not evaluate their arguments, so untraced builds compile to the same code
+// as before.
+#pragma once
+
+#include <string>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(SCHEDULER_TRACING)
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#endif
+
+// --- Trace Events ---
+// Preempt: a job displaced by another one. Expire: a job's time slice ran
+// out; it may be dispatched again right away if nothing else is waiting.
+enum class TraceKind : uint8_t { RunBegin, Arrival, Dispatch, Preempt, Expire, Complete };
+
+struct TraceEvent {
+    int64_t time;    // Simulated time; for RunBegin the global run number
+    int32_t job;     // Job id
+    uint16_t cpu;
+    TraceKind kind;
+    uint8_t unused;
+};
+static_assert(sizeof(TraceEvent) == 16, "trace events must stay 16 bytes");
+
+// Whether this build records events, so callers can refuse up front
+#if defined(SCHEDULER_TRACING)
+constexpr bool kSchedulerTracing = true;
+#else
+constexpr bool kSchedulerTracing = false;
+#endif
+
+#if defined(SCHEDULER_TRACING)
+
+constexpr size_t kDefaultTraceCapacity = size_t(1) << 20; // Events per thread (16 MB)
+
+// --- Per-Thread Ring ---
+class TraceRing {
+public:
+    explicit TraceRing(unsigned thread) : thread_(thread), events_(kDefaultTraceCapacity) {}
+
+    void record(TraceKind kind, long long time, int job, int cpu) {
+        events_[written_ % events_.size()] = TraceEvent{time, job, static_cast<uint16_t>(cpu), kind, 0};
+        written_++;
+        if (kind == TraceKind::RunBegin) lastRun_ = time;
+    }
+
+    long long lastRun() const { return lastRun_; }
+
+    unsigned thread() const { return thread_; }
+    size_t size() const { return written_ < events_.size() ? written_ : events_.size(); }
+    size_t dropped() const { return written_ - size(); }
+
+    // i-th retained event, oldest first
+    const TraceEvent& at(size_t i) const { return events_[(written_ - size() + i) % events_.size()]; }
+
+private:
+    unsigned thread_;
+    std::vector<TraceEvent> events_;
+    size_t written_ = 0;
+    long long lastRun_ = -1;
+};
+
+// Every ring ever created, so the export can reach rings of finished threads
+struct TraceRegistry {
+    std::mutex lock;
+    std::vector<std::unique_ptr<TraceRing>> rings;
+    std::unordered_map<long long, std::string> labels; // Run number -> name
+    std::atomic<long long> runs{0};
+
+    static TraceRegistry& instance() {
+        static TraceRegistry registry;
+        return registry;
+    }
+};
+
+inline TraceRing& threadTraceRing() {
+    thread_local TraceRing* ring = nullptr;
+    if (!ring) {
+        TraceRegistry& registry = TraceRegistry::instance();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        registry.rings.emplace_back(new TraceRing(static_cast<unsigned>(registry.rings.size())));
+        ring = registry.rings.back().get();
+    }
+    return *ring;
+}
+
+inline void schedTraceRecord(TraceKind kind, long long time, int job, int cpu) {
+    threadTraceRing().record(kind, time, job, cpu);
+}
+
+inline void schedTraceBeginRun() {
+    long long run = TraceRegistry::instance().runs.fetch_add(1, std::memory_order_relaxed);
+    threadTraceRing().record(TraceKind::RunBegin, run, -1, 0);
+}
+
+// Names the calling thread's latest run in the exported trace
+inline void schedTraceLabelRun(const std::string& label) {
+    long long run = threadTraceRing().lastRun();
+    TraceRegistry& registry = TraceRegistry::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.labels[run] = label;
+}
+
+#define SCHED_TRACE(kind, time, job, cpu) schedTraceRecord(TraceKind::kind, (time), (job), (cpu))
+#define SCHED_TRACE_RUN() schedTraceBeginRun()
+#define SCHED_TRACE_LABEL(label) schedTraceLabelRun(label)
+
+// --- Chrome Trace Export ---
+// Simulated time units are written as microseconds. Call after all traced
+// runs have finished.
+inline bool exportChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: cannot write trace " << path << std::endl;
+        return false;
+    }
+    TraceRegistry& registry = TraceRegistry::instance();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    const char* separator = "\n";
+    auto emit = [&](const std::string& event) {
+        out << separator << event;
+        separator = ",\n";
+    };
+
+    out << "{\"traceEvents\":[";
+    size_t dropped = 0;
+    for (const auto& ring : registry.rings) {
+        dropped += ring->dropped();
+        long long run = -1;                             // -1 until the ring's first RunBegin
+        std::unordered_map<int, int64_t> sliceStart;    // cpu -> dispatch time of its running job
+        for (size_t i = 0; i < ring->size(); ++i) {
+            const TraceEvent& e = ring->at(i);
+            if (e.kind == TraceKind::RunBegin) {
+                run = e.time;
+                sliceStart.clear();
+                auto label = registry.labels.find(run);
+                emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(run) +
+                     ",\"args\":{\"name\":\"run " + std::to_string(run) +
+                     (label != registry.labels.end() ? " " + label->second : std::string()) + " (thread " +
+                     std::to_string(ring->thread()) + ")\"}}");
+                continue;
+            }
+            if (run < 0) continue; // Start of the run was overwritten
+            std::string common = ",\"pid\":" + std::to_string(run) + ",\"ts\":" + std::to_string(e.time);
+            std::string job = std::to_string(e.job);
+            std::string span = "\"id\":\"" + std::to_string(run) + "." + job + "\""; // Unique across runs
+            switch (e.kind) {
+                case TraceKind::Arrival:
+                    emit("{\"name\":\"job " + job + "\",\"cat\":\"job\",\"ph\":\"b\"," + span + common + "}");
+                    break;
+                case TraceKind::Dispatch:
+                    sliceStart[e.cpu] = e.time;
+                    break;
+                case TraceKind::Preempt:
+                case TraceKind::Expire:
+                case TraceKind::Complete: {
+                    auto start = sliceStart.find(e.cpu);
+                    if (start != sliceStart.end()) {
+                        emit("{\"name\":\"job " + job + "\",\"ph\":\"X\",\"pid\":" + std::to_string(run) +
+                             ",\"tid\":" + std::to_string(e.cpu) + ",\"ts\":" + std::to_string(start->second) +
+                             ",\"dur\":" + std::to_string(e.time - start->second) + "}");
+                        sliceStart.erase(start);
+                    }
+                    if (e.kind == TraceKind::Preempt) {
+                        emit("{\"name\":\"preempt\",\"ph\":\"i\",\"s\":\"t\",\"tid\":" + std::to_string(e.cpu) +
+                             common + ",\"args\":{\"job\":" + job + "}}");
+                    } else if (e.kind == TraceKind::Complete) {
+                        emit("{\"name\":\"job " + job + "\",\"cat\":\"job\",\"ph\":\"e\"," + span + common + "}");
+                    }
+                    break;
+                }
+                case TraceKind::RunBegin:
+                    break;
+            }
+        }
+    }
+    out << "\n]}\n";
+    if (dropped > 0) {
+        std::cerr << "Warning: " << dropped << " trace events were overwritten; the oldest runs are incomplete."
+                  << std::endl;
+    }
+    return static_cast<bool>(out);
+}
+
+#else
+
+#define SCHED_TRACE(kind, time, job, cpu) ((void)0)
+#define SCHED_TRACE_RUN() ((void)0)
+#define SCHED_TRACE_LABEL(label) ((void)0)
+
+inline bool exportChromeTrace(const std::string& path) {
+    std::cerr << "Error: cannot write " << path << ": built without -DSCHEDULER_TRACING" << std::endl;
+    return false;
+}
+
+#endif // SCHEDULER_TRACING
@@ -6,6 +6,7 @@
 #include <random>
 #include <iomanip>
 #include <climits>
+#include "EventEngine.h"
 using namespace std;
 
 struct Process {
@@ -28,98 +29,45 @@ vector<Process> generate_processes(int n, int k, double d, double v) {
     return procs;
 }
 
-// FIFO Algorithm
-void simulate_FIFO(vector<Process> procs) {
-    int t = 0;
+// Runs the processes through the shared event engine (EventEngine.h),
+// specialized for Policy, and returns the average turnaround time
+template <typename Policy>
+double simulate(vector<Process>& procs) {
     int n = procs.size();
-    vector<bool> finished(n, false);
-
-    while (count(finished.begin(), finished.end(), false) > 0) {
-        int idx = -1;
-        for (int i = 0; i < n; ++i) {
-            if (!finished[i] && procs[i].arrival <= t) {
-                idx = i;
-                break;
-            }
-        }
-        if (idx == -1) { t++; continue; }
+    Workload w;
+    w.reserve(n);
+    for (const auto& p : procs) w.add(p.arrival, p.total);
+    Simulator<Policy>().run(w);
 
-        while (procs[idx].remaining > 0) {
-            procs[idx].remaining--;
-            t++;
-        }
-        procs[idx].turnaround = t - procs[idx].arrival;
-        finished[idx] = true;
+    double ATT = 0;
+    for (int i = 0; i < n; ++i) {
+        procs[i].remaining = 0;
+        procs[i].turnaround = w.completionTime[i] - procs[i].arrival;
+        ATT += procs[i].turnaround;
     }
+    return ATT / n;
+}
 
-    double ATT = 0;
-    for (auto& p : procs) ATT += p.turnaround;
-    ATT /= n;
+// FIFO Algorithm: lowest pid among arrived processes, runs to completion
+void simulate_FIFO(vector<Process> procs) {
+    double ATT = simulate<IndexOrderPolicy>(procs);
     cout << "FIFO ATT = " << fixed << setprecision(2) << ATT << endl;
 }
 
-// SJF Algorithm
+// SJF Algorithm: shortest total time among arrived processes, runs to completion
 void simulate_SJF(vector<Process> procs) {
-    int t = 0;
-    int n = procs.size();
-    vector<bool> finished(n, false);
-
-    while (count(finished.begin(), finished.end(), false) > 0) {
-        int idx = -1;
-        int min_time = INT_MAX;
-        for (int i = 0; i < n; ++i) {
-            if (!finished[i] && procs[i].arrival <= t && procs[i].total < min_time) {
-                min_time = procs[i].total;
-                idx = i;
-            }
-        }
-        if (idx == -1) { t++; continue; }
-
-        while (procs[idx].remaining > 0) {
-            procs[idx].remaining--;
-            t++;
-        }
-        procs[idx].turnaround = t - procs[idx].arrival;
-        finished[idx] = true;
-    }
-
-    double ATT = 0;
-    for (auto& p : procs) ATT += p.turnaround;
-    ATT /= n;
+    double ATT = simulate<SjfPolicy>(procs);
     cout << "SJF ATT = " << fixed << setprecision(2) << ATT << endl;
 }
 
-// SRT Algorithm
+// SRT Algorithm: shortest remaining time, re-checked whenever a process arrives
 void simulate_SRT(vector<Process> procs) {
-    int t = 0;
-    int n = procs.size();
-    vector<bool> finished(n, false);
-
-    while (count(finished.begin(), finished.end(), false) > 0) {
-        int idx = -1;
-        int min_remaining = INT_MAX;
-        for (int i = 0; i < n; ++i) {
-            if (!finished[i] && procs[i].arrival <= t && procs[i].remaining < min_remaining && procs[i].remaining > 0) {
-                min_remaining = procs[i].remaining;
-                idx = i;
-            }
-        }
-        if (idx == -1) { t++; continue; }
-
-        procs[idx].remaining--;
-        t++;
-        if (procs[idx].remaining == 0) {
-            procs[idx].turnaround = t - procs[idx].arrival;
-            finished[idx] = true;
-        }
-    }
-
-    double ATT = 0;
-    for (auto& p : procs) ATT += p.turnaround;
-    ATT /= n;
+    double ATT = simulate<SrtPolicy>(procs);
     cout << "SRT ATT = " << fixed << setprecision(2) << ATT << endl;
 }
 
+// Benchmark.cpp includes this file with SCHEDULER_NO_MAIN defined.
+#ifndef SCHEDULER_NO_MAIN
 int main() {
     int n = 50; // number of processes
     int k = 200; // max arrival time
@@ -131,3 +79,4 @@ int main() {
     simulate_SRT(procs);
     return 0;
 }
+#endif // SCHEDULER_NO_MAIN
@@ -0,0 +1,353 @@
+// Vectorized kernels for workload generation, turnaround statistics and
+// FIFO completion times.
+// Built with -mavx2 (or -march=native on an AVX2 machine) the kernels below
+// use AVX2 intrinsics; otherwise a scalar fallback runs the same arithmetic
+// in the same order, lane by lane.
+#pragma once
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Workload.h"
+
+// --- Batched Normal Sampler ---
+// Box-Muller on blocks of 8 raw 32-bit draws: lanes 0-3 hold u1, lanes 4-7
+// hold u2, and the block yields r*cos(theta) for the first four outputs and
+// r*sin(theta) for the last four. log, sin and cos are evaluated with short
+// polynomials (accurate to ~1e-15) so the vector path needs no libm calls.
+namespace simd_detail {
+
+constexpr double kTwoPi = 6.283185307179586476925;
+constexpr double kLn2 = 0.693147180559945309417;
+constexpr double kSqrt2 = 1.414213562373095048802;
+constexpr double kTwo52 = 4503599627370496.0; // 2^52, for int64 <-> double tricks
+constexpr double kInv2Pow32 = 1.0 / 4294967296.0;
+
+// Maps a raw draw to (0, 1), never returning 0 so log(u) is finite
+inline double unitOpen(uint32_t x) { return (static_cast<double>(x) + 0.5) * kInv2Pow32; }
+
+// ln(u) for u in (0, 1): u = m * 2^e with m in [sqrt(1/2), sqrt(2)),
+// ln(m) = 2 atanh(f) with f = (m - 1) / (m + 1)
+inline double logPoly(double u) {
+    uint64_t bits;
+    std::memcpy(&bits, &u, sizeof bits);
+    double e = static_cast<double>(static_cast<int64_t>(bits >> 52)) - 1023.0;
+    uint64_t mbits = (bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+    double m;
+    std::memcpy(&m, &mbits, sizeof m);
+    if (m > kSqrt2) {
+        m = m * 0.5;
+        e = e + 1.0;
+    }
+    double f = (m - 1.0) / (m + 1.0);
+    double s = f * f;
+    double p = 1.0 / 17;
+    p = p * s + 1.0 / 15;
+    p = p * s + 1.0 / 13;
+    p = p * s + 1.0 / 11;
+    p = p * s + 1.0 / 9;
+    p = p * s + 1.0 / 7;
+    p = p * s + 1.0 / 5;
+    p = p * s + 1.0 / 3;
+    p = p * s + 1.0;
+    return e * kLn2 + 2.0 * f * p;
+}
+
+// sin(x) and cos(x) for |x| <= pi/4 (Taylor series up to x^15 / x^16)
+inline double sinPoly(double x) {
+    double s = x * x;
+    double p = -1.0 / 1307674368000.0;
+    p = p * s + 1.0 / 6227020800.0;
+    p = p * s - 1.0 / 39916800.0;
+    p = p * s + 1.0 / 362880.0;
+    p = p * s - 1.0 / 5040.0;
+    p = p * s + 1.0 / 120.0;
+    p = p * s - 1.0 / 6.0;
+    p = p * s + 1.0;
+    return x * p;
+}
+
+inline double cosPoly(double x) {
+    double s = x * x;
+    double p = 1.0 / 20922789888000.0;
+    p = p * s - 1.0 / 87178291200.0;
+    p = p * s + 1.0 / 479001600.0;
+    p = p * s - 1.0 / 3628800.0;
+    p = p * s + 1.0 / 40320.0;
+    p = p * s - 1.0 / 720.0;
+    p = p * s + 1.0 / 24.0;
+    p = p * s - 1.0 / 2.0;
+    p = p * s + 1.0;
+    return p;
+}
+
+// One Box-Muller pair from two raw draws
+inline void boxMuller(uint32_t x1, uint32_t x2, double& z0, double& z1) {
+    double r = std::sqrt(-2.0 * logPoly(unitOpen(x1)));
+    // theta = 2*pi*u2 = q*pi/2 + x with quadrant q in 0..4 and |x| <= pi/4
+    double u2 = unitOpen(x2);
+    double q = std::floor(u2 * 4.0 + 0.5);
+    double x = (u2 - q * 0.25) * kTwoPi;
+    double c = cosPoly(x), s = sinPoly(x);
+    bool swap = (q == 1.0 || q == 3.0);
+    bool cosNeg = (q == 1.0 || q == 2.0);
+    bool sinNeg = (q == 2.0 || q == 3.0);
+    double cosTheta = swap ? s : c;
+    double sinTheta = swap ? c : s;
+    z0 = r * (cosNeg ? -cosTheta : cosTheta);
+    z1 = r * (sinNeg ? -sinTheta : sinTheta);
+}
+
+// Burst time from a standard normal sample, rounded and at least 1
+inline int burstFromNormal(double z, double d, double v) {
+    double b = std::floor(d + v * z + 0.5);
+    return b < 1.0 ? 1 : static_cast<int>(b);
+}
+
+#if defined(__AVX2__)
+// Unsigned 32-bit lanes to doubles (AVX2 only converts signed lanes)
+inline __m256d u32ToPd(__m128i x) {
+    __m128i flipped = _mm_xor_si128(x, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    return _mm256_add_pd(_mm256_cvtepi32_pd(flipped), _mm256_set1_pd(2147483648.0));
+}
+
+// Non-negative int64 lanes below 2^52 to doubles
+inline __m256d i64ToPd(__m256i x) {
+    __m256i magic = _mm256_castpd_si256(_mm256_set1_pd(kTwo52));
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(x, magic)), _mm256_set1_pd(kTwo52));
+}
+
+inline __m256d horner(__m256d s, const double* coeffs, int count) {
+    __m256d p = _mm256_set1_pd(coeffs[0]);
+    for (int i = 1; i < count; ++i) {
+        p = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(coeffs[i]));
+    }
+    return p;
+}
+
+inline __m256d logPoly(__m256d u) {
+    static const double coeffs[] = {1.0 / 17, 1.0 / 15, 1.0 / 13, 1.0 / 11, 1.0 / 9,
+                                    1.0 / 7, 1.0 / 5, 1.0 / 3, 1.0};
+    __m256i bits = _mm256_castpd_si256(u);
+    __m256d e = _mm256_sub_pd(i64ToPd(_mm256_srli_epi64(bits, 52)), _mm256_set1_pd(1023.0));
+    __m256i mbits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                    _mm256_set1_epi64x(0x3FF0000000000000LL));
+    __m256d m = _mm256_castsi256_pd(mbits);
+    __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    e = _mm256_blendv_pd(e, _mm256_add_pd(e, _mm256_set1_pd(1.0)), big);
+    __m256d one = _mm256_set1_pd(1.0);
+    __m256d f = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    __m256d p = horner(_mm256_mul_pd(f, f), coeffs, 9);
+    return _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(kLn2)),
+                         _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), f), p));
+}
+
+inline void boxMuller(__m128i x1, __m128i x2, __m256d& z0, __m256d& z1) {
+    static const double sinCoeffs[] = {-1.0 / 1307674368000.0, 1.0 / 6227020800.0, -1.0 / 39916800.0,
+                                       1.0 / 362880.0, -1.0 / 5040.0, 1.0 / 120.0, -1.0 / 6.0, 1.0};
+    static const double cosCoeffs[] = {1.0 / 20922789888000.0, -1.0 / 87178291200.0, 1.0 / 479001600.0,
+                                       -1.0 / 3628800.0, 1.0 / 40320.0, -1.0 / 720.0, 1.0 / 24.0,
+                                       -1.0 / 2.0, 1.0};
+    __m256d half = _mm256_set1_pd(0.5);
+    __m256d scale = _mm256_set1_pd(kInv2Pow32);
+    __m256d u1 = _mm256_mul_pd(_mm256_add_pd(u32ToPd(x1), half), scale);
+    __m256d u2 = _mm256_mul_pd(_mm256_add_pd(u32ToPd(x2), half), scale);
+    __m256d r = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), logPoly(u1)));
+
+    __m256d q = _mm256_floor_pd(_mm256_add_pd(_mm256_mul_pd(u2, _mm256_set1_pd(4.0)), half));
+    __m256d x = _mm256_mul_pd(_mm256_sub_pd(u2, _mm256_mul_pd(q, _mm256_set1_pd(0.25))),
+                              _mm256_set1_pd(kTwoPi));
+    __m256d s2 = _mm256_mul_pd(x, x);
+    __m256d c = horner(s2, cosCoeffs, 9);
+    __m256d s = _mm256_mul_pd(x, horner(s2, sinCoeffs, 8));
+
+    __m256d q1 = _mm256_cmp_pd(q, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+    __m256d q2 = _mm256_cmp_pd(q, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+    __m256d q3 = _mm256_cmp_pd(q, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+    __m256d swap = _mm256_or_pd(q1, q3);
+    __m256d signBit = _mm256_set1_pd(-0.0);
+    __m256d cosTheta = _mm256_blendv_pd(c, s, swap);
+    __m256d sinTheta = _mm256_blendv_pd(s, c, swap);
+    cosTheta = _mm256_xor_pd(cosTheta, _mm256_and_pd(_mm256_or_pd(q1, q2), signBit));
+    sinTheta = _mm256_xor_pd(sinTheta, _mm256_and_pd(_mm256_or_pd(q2, q3), signBit));
+    z0 = _mm256_mul_pd(r, cosTheta);
+    z1 = _mm256_mul_pd(r, sinTheta);
+}
+
+inline __m128i burstFromNormal(__m256d z, __m256d d, __m256d v) {
+    __m256d b = _mm256_floor_pd(_mm256_add_pd(_mm256_add_pd(d, _mm256_mul_pd(v, z)), _mm256_set1_pd(0.5)));
+    b = _mm256_max_pd(b, _mm256_set1_pd(1.0));
+    return _mm256_cvttpd_epi32(b);
+}
+#endif
+
+} // namespace simd_detail
+
+// --- Batched Workload Generation ---
+// n jobs with arrivals uniform on [0, k] and bursts ~ round(N(d, v)), at
+// least 1. All raw draws are taken from gen up front (n for arrivals, then n
+// rounded up to a multiple of 8 for bursts), then transformed in bulk.
+// Passing `scratch` keeps the raw-draw buffer between calls; together with
+// a reused w this generates without allocating once the sizes have been seen.
+inline void generateWorkload(Workload& w, int n, int k, double d, double v, std::mt19937& gen,
+                             std::vector<uint32_t>* scratch = nullptr) {
+    using namespace simd_detail;
+    const size_t count = static_cast<size_t>(n);
+    const size_t padded = (count + 7) & ~static_cast<size_t>(7);
+    w.resize(count);
+    std::vector<uint32_t> local;
+    std::vector<uint32_t>& raw = scratch ? *scratch : local;
+    raw.resize(padded);
+
+    // Arrivals: arrival = (x * (k + 1)) >> 32 maps a 32-bit draw onto [0, k]
+    uint32_t* arrivalBits = reinterpret_cast<uint32_t*>(w.arrivalTime.data());
+    for (size_t i = 0; i < count; ++i) arrivalBits[i] = static_cast<uint32_t>(gen());
+    const uint64_t range = static_cast<uint64_t>(k) + 1;
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i rangeVec = _mm256_set1_epi64x(static_cast<long long>(range));
+    const __m256i highMask = _mm256_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ULL));
+    for (; i + 8 <= count; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrivalBits + i));
+        __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(x, rangeVec), 32);
+        __m256i odd = _mm256_and_si256(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), rangeVec), highMask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(arrivalBits + i), _mm256_or_si256(even, odd));
+    }
+#endif
+    for (; i < count; ++i) {
+        arrivalBits[i] = static_cast<uint32_t>((arrivalBits[i] * range) >> 32);
+    }
+
+    // Bursts: one Box-Muller block per 8 jobs
+    for (size_t j = 0; j < padded; ++j) raw[j] = static_cast<uint32_t>(gen());
+    int* burst = w.totalCpuTime.data();
+    size_t block = 0;
+#if defined(__AVX2__)
+    const __m256d dVec = _mm256_set1_pd(d), vVec = _mm256_set1_pd(v);
+    for (; block + 8 <= count; block += 8) {
+        __m256d z0, z1;
+        boxMuller(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&raw[block])),
+                  _mm_loadu_si128(reinterpret_cast<const __m128i*>(&raw[block + 4])), z0, z1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(burst + block), burstFromNormal(z0, dVec, vVec));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(burst + block + 4), burstFromNormal(z1, dVec, vVec));
+    }
+#endif
+    for (; block < count; block += 8) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            double z0, z1;
+            boxMuller(raw[block + lane], raw[block + 4 + lane], z0, z1);
+            if (block + lane < count) burst[block + lane] = burstFromNormal(z0, d, v);
+            if (block + 4 + lane < count) burst[block + 4 + lane] = burstFromNormal(z1, d, v);
+        }
+    }
+    w.reset();
+}
+
+// --- Turnaround Statistics ---
+// Tails of turnaround come from LatencyHistogram.h, which needs no per-job
+// storage; this reduction only produces the summary every run reports.
+struct TurnaroundStats {
+    size_t completed = 0;  // Jobs with a completion time
+    double mean = 0.0;     // Average turnaround time (ATT)
+    double max = 0.0;
+};
+
+// One pass over completion and arrival times computes count, sum and max of
+// turnaround = completion - arrival, skipping jobs whose completion is still
+// -1 with a lane mask instead of a branch. Turnaround sums are exact while
+// they stay below 2^53, so the mean is bit-identical to a scalar loop.
+inline TurnaroundStats reduceTurnaround(const Workload& w) {
+    using namespace simd_detail;
+    const size_t n = w.size();
+    const long long* completion = w.completionTime.data();
+    const int* arrival = w.arrivalTime.data();
+    TurnaroundStats stats;
+    if (n == 0) return stats;
+
+    double count = 0.0, sum = 0.0, maxValue = 0.0;
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256d countVec = _mm256_setzero_pd(), sumVec = _mm256_setzero_pd(), maxVec = _mm256_setzero_pd();
+    const __m256d oneVec = _mm256_set1_pd(1.0);
+    const __m256i sentinel = _mm256_set1_epi64x(-1);
+    for (; i + 4 <= n; i += 4) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(completion + i));
+        __m256i a = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(arrival + i)));
+        __m256d valid = _mm256_castsi256_pd(_mm256_xor_si256(_mm256_cmpeq_epi64(c, sentinel), sentinel));
+        __m256d tt = _mm256_and_pd(i64ToPd(_mm256_sub_epi64(c, a)), valid);
+        countVec = _mm256_add_pd(countVec, _mm256_and_pd(oneVec, valid));
+        sumVec = _mm256_add_pd(sumVec, tt);
+        maxVec = _mm256_max_pd(maxVec, tt);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, countVec);
+    count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm256_storeu_pd(lanes, sumVec);
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm256_storeu_pd(lanes, maxVec);
+    maxValue = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#endif
+    for (; i < n; ++i) {
+        double valid = completion[i] != -1 ? 1.0 : 0.0;
+        double tt = valid * static_cast<double>(completion[i] - arrival[i]);
+        count += valid;
+        sum += tt;
+        maxValue = std::max(maxValue, tt);
+    }
+
+    stats.completed = static_cast<size_t>(count);
+    if (stats.completed == 0) return stats;
+    stats.mean = sum / count;
+    stats.max = maxValue;
+    return stats;
+}
+
+// --- FIFO Completion Scan ---
+// Completion times of jobs run to completion in the order given (arrival
+// order for FIFO): c[i] = max(c[i-1], a[i]) + b[i], starting from the CPU
+// free at `carry` (min() if it starts idle). Returns the last completion,
+// or carry for no jobs. With s the running sum of b this is
+//   c[i] = s[i] + max(carry, max over j <= i of (a[j] + b[j] - s[j])),
+// a prefix sum and a prefix max, so blocks of four jobs are scanned in
+// registers with two shift steps each and only the last lane carries on.
+// Every step is exact integer arithmetic, so both paths give the same times.
+inline long long fifoCompletionScan(const int* a, const int* b, long long* c, size_t n, long long carry) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i carryVec = _mm256_set1_epi64x(carry);
+    for (; i + 4 <= n; i += 4) {
+        __m256i av = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+        __m256i bv = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        // Inclusive prefix sum of b: add the lanes shifted up by one, then by two
+        __m256i s = _mm256_add_epi64(bv, _mm256_blend_epi32(_mm256_permute4x64_epi64(bv, 0x90), zero, 0x03));
+        s = _mm256_add_epi64(s, _mm256_blend_epi32(_mm256_permute4x64_epi64(s, 0x40), zero, 0x0F));
+        // Inclusive prefix max of a + b - s; shifting repeats lane 0, which max absorbs
+        __m256i m = _mm256_sub_epi64(_mm256_add_epi64(av, bv), s);
+        __m256i shifted = _mm256_permute4x64_epi64(m, 0x90);
+        m = _mm256_blendv_epi8(m, shifted, _mm256_cmpgt_epi64(shifted, m));
+        shifted = _mm256_permute4x64_epi64(m, 0x40);
+        m = _mm256_blendv_epi8(m, shifted, _mm256_cmpgt_epi64(shifted, m));
+        m = _mm256_blendv_epi8(m, carryVec, _mm256_cmpgt_epi64(carryVec, m));
+        __m256i cv = _mm256_add_epi64(s, m);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + i), cv);
+        carryVec = _mm256_permute4x64_epi64(cv, 0xFF);
+    }
+    if (i > 0) carry = c[i - 1];
+#endif
+    for (; i < n; ++i) {
+        carry = std::max(carry, static_cast<long long>(a[i])) + b[i];
+        c[i] = carry;
+    }
+    return carry;
+}
@@ -0,0 +1,72 @@
+// Reusable state for running many replications on one thread. A context owns
+// the workload arrays, the generator's raw-draw buffer, the arrival order and
+// one Simulator per policy (each keeping its ready queue), and every run
+// reuses them in place. FIFO skips the simulator and uses the closed form of
+// FifoScan.h over the same arrival order. Once a context has seen the largest workload it will
+// be given, generating and simulating a replication makes no heap
+// allocations.
+//
+//   SimulationContext context;                 // one per worker thread
+//   context.generate(n, k, d, v, gen);
+//   double fifo = context.run<FifoPolicy>();   // ATT; the workload is reset
+//   double srt = context.run<SrtPolicy>();     // between runs
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <type_traits>
+#include <random>
+#include <iostream>
+#include <cstdint>
+
+#include "EventEngine.h"
+#include "FifoScan.h"
+#include "SimdKernels.h"
+#include "Workload.h"
+
+// --- Simulation Context ---
+class SimulationContext {
+public:
+    // Replaces the workload with n freshly drawn jobs (see generateWorkload)
+    Workload& generate(int n, int k, double d, double v, std::mt19937& gen) {
+        generateWorkload(workload_, n, k, d, v, gen, &raw_);
+        orderValid_ = false;
+        return workload_;
+    }
+
+    // Runs the current workload through Policy from a clean state and returns
+    // its average turnaround time. The arrival order is sorted on the first
+    // run after generate() and shared by the runs that follow.
+    template <typename Policy>
+    double run() {
+        if constexpr (std::is_same<Policy, FifoPolicy>::value) {
+            // Closed form over the arrival order (see FifoScan.h)
+            if (!orderValid_) sortArrivalOrder(workload_.arrivalTime, order_);
+            orderValid_ = true;
+            fifoCompleteInOrder(workload_, order_.data(), order_.size(), 0);
+        } else {
+            workload_.reset();
+            WorkloadJobs jobs(workload_, order_, orderValid_);
+            orderValid_ = true;
+            Simulator<Policy>& simulator = std::get<Simulator<Policy>>(simulators_);
+            simulator.reserve(workload_.size()); // The ready queue never holds more
+            simulator.run(jobs);
+        }
+
+        TurnaroundStats stats = reduceTurnaround(workload_);
+        if (stats.completed != workload_.size()) {
+            std::cerr << "Warning: completed " << stats.completed << "/" << workload_.size() << " processes." << std::endl;
+        }
+        return stats.mean;
+    }
+
+    const Workload& workload() const { return workload_; }
+
+private:
+    Workload workload_;
+    std::vector<uint32_t> raw_;  // Raw draws for generateWorkload
+    std::vector<int> order_;     // Job indices in arrival order
+    bool orderValid_ = false;    // order_ matches the current workload
+    std::tuple<Simulator<FifoPolicy>, Simulator<IndexOrderPolicy>, Simulator<SjfPolicy>, Simulator<SrtPolicy>>
+        simulators_;
+};
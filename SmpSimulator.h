@@ -0,0 +1,222 @@
+// Multi-core (SMP) variant of the event engine: m identical CPUs run the same
+// FIFO/SJF/SRT orderings as EventEngine.h, either from one global ready queue
+// or from per-CPU run queues with work stealing.
+//
+// Global:  arrivals enter one shared queue; an idle CPU takes its best job.
+//          Under preemption an arrival displaces the worst running job if it
+//          beats it.
+// PerCpu:  each arrival is placed on the least-loaded CPU's queue (queued plus
+//          running jobs, ties to the lower CPU). A CPU that runs dry steals the
+//          best job from the CPU with the longest queue. Preemption only
+//          compares a CPU's running job with its own queue.
+//
+// A job that starts on a CPU other than the one it last ran on (or was placed
+// on) pays migrationCost extra time units; with m == 1 both modes reproduce
+// runEventSimulation() exactly.
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+#include "EventEngine.h"
+#include "ReadyQueue.h"
+#include "SchedTrace.h"
+#include "Workload.h"
+
+// --- Configuration and Results ---
+enum class SmpQueueing { Global, PerCpu };
+
+struct SmpConfig {
+    int cpus = 1;
+    SmpQueueing queueing = SmpQueueing::Global;
+    int migrationCost = 0; // Extra time units charged when a job changes CPU
+};
+
+struct SmpStats {
+    double averageTurnaround = 0.0;
+    long long makespan = 0;                 // Time of the last completion
+    std::vector<double> utilization;        // Busy fraction of [0, makespan] per CPU
+    std::vector<size_t> completedPerCpu;    // Jobs each CPU finished
+    size_t preemptions = 0;
+    size_t migrations = 0;
+    size_t steals = 0;                      // PerCpu only
+};
+
+// --- SMP Simulation ---
+inline SmpStats runSmpSimulation(Workload& w, QueueKey key, bool preemptive, const SmpConfig& config) {
+    const long long never = std::numeric_limits<long long>::max();
+    const int m = std::max(1, config.cpus);
+    const bool perCpu = config.queueing == SmpQueueing::PerCpu;
+    w.reset();
+    WorkloadJobs jobs(w);
+    SCHED_TRACE_RUN();
+
+    struct Cpu {
+        int running = -1;       // Job index, -1 if idle
+        long long runStart = 0; // When the running job (re)started
+        long long busy = 0;
+        unsigned epoch = 0;     // Invalidates stale completion events
+        MinHeapReadyQueue queue;
+    };
+    std::vector<Cpu> cpus(m);
+    MinHeapReadyQueue globalQueue;
+    std::vector<int> lastCpu(w.size(), -1);
+
+    // Pending completions as (finish time, cpu, epoch), earliest first
+    struct Completion {
+        long long time;
+        int cpu;
+        unsigned epoch;
+        bool operator>(const Completion& o) const { return time != o.time ? time > o.time : cpu > o.cpu; }
+    };
+    std::priority_queue<Completion, std::vector<Completion>, std::greater<Completion>> completions;
+
+    SmpStats stats;
+    stats.completedPerCpu.assign(m, 0);
+    long long currentTime = 0;
+    double totalTurnaroundTime = 0;
+    size_t completed = 0;
+
+    auto entryOf = [&](int i) -> ReadyEntry {
+        long long k = 0;
+        switch (key) {
+            case QueueKey::Arrival:      k = w.arrivalTime[i]; break;
+            case QueueKey::Index:        k = i; break;
+            case QueueKey::TotalCpu:     k = w.totalCpuTime[i]; break;
+            case QueueKey::RemainingCpu: k = w.remainingCpuTime[i]; break;
+        }
+        return ReadyEntry{k, i, i};
+    };
+
+    auto start = [&](int c, int job) {
+        Cpu& cpu = cpus[c];
+        if (lastCpu[job] != -1 && lastCpu[job] != c) {
+            w.remainingCpuTime[job] += config.migrationCost;
+            stats.migrations++;
+        }
+        lastCpu[job] = c;
+        SCHED_TRACE(Dispatch, currentTime, job, c);
+        cpu.running = job;
+        cpu.runStart = currentTime;
+        cpu.epoch++;
+        completions.push(Completion{currentTime + w.remainingCpuTime[job], c, cpu.epoch});
+    };
+
+    // Takes the running job off CPU c, charging the time it ran
+    auto stop = [&](int c) {
+        Cpu& cpu = cpus[c];
+        int job = cpu.running;
+        w.remainingCpuTime[job] -= static_cast<int>(currentTime - cpu.runStart);
+        cpu.busy += currentTime - cpu.runStart;
+        cpu.running = -1;
+        cpu.epoch++;
+        return job;
+    };
+
+    // Best job for an idle CPU c, or -1 if there is no waiting work
+    auto takeWork = [&](int c) {
+        if (!perCpu) return globalQueue.empty() ? -1 : globalQueue.pop().slot;
+        if (!cpus[c].queue.empty()) return cpus[c].queue.pop().slot;
+        int victim = -1;
+        for (int v = 0; v < m; ++v) {
+            if (!cpus[v].queue.empty() && (victim == -1 || cpus[v].queue.size() > cpus[victim].queue.size())) {
+                victim = v;
+            }
+        }
+        if (victim == -1) return -1;
+        stats.steals++;
+        return cpus[victim].queue.pop().slot;
+    };
+
+    // Queue entry of CPU c's running job with its remaining time as of now
+    auto runningEntry = [&](int c) {
+        ReadyEntry e = entryOf(cpus[c].running);
+        if (key == QueueKey::RemainingCpu) e.key -= currentTime - cpus[c].runStart;
+        return e;
+    };
+
+    auto loadOf = [&](int c) { return cpus[c].queue.size() + (cpus[c].running != -1 ? 1 : 0); };
+
+    while (completed < w.size()) {
+        // 1. Jump to the next event time. The clock starts at 0 and never moves
+        // back, so jobs arriving earlier are admitted at 0, as in Simulator.
+        while (!completions.empty() && completions.top().epoch != cpus[completions.top().cpu].epoch) {
+            completions.pop(); // Job was preempted since this was scheduled
+        }
+        long long nextDone = completions.empty() ? never : completions.top().time;
+        currentTime = std::max(currentTime, std::min(nextDone, jobs.nextArrivalTime()));
+
+        // 2. Retire every job finishing now
+        while (!completions.empty() && completions.top().time == currentTime) {
+            Completion done = completions.top();
+            completions.pop();
+            if (done.epoch != cpus[done.cpu].epoch) continue;
+            int job = stop(done.cpu);
+            SCHED_TRACE(Complete, currentTime, job, done.cpu);
+            w.completionTime[job] = currentTime;
+            totalTurnaroundTime += static_cast<double>(currentTime - w.arrivalTime[job]);
+            stats.completedPerCpu[done.cpu]++;
+            completed++;
+        }
+
+        // 3. Admit arrivals into the global queue or the least-loaded CPU
+        bool arrivedNow = false;
+        while (jobs.hasArrivedBy(currentTime)) {
+            int job = jobs.admit();
+            SCHED_TRACE(Arrival, w.arrivalTime[job], job, 0);
+            arrivedNow = true;
+            if (!perCpu) {
+                globalQueue.push(entryOf(job));
+                continue;
+            }
+            int target = 0;
+            for (int c = 1; c < m; ++c) {
+                if (loadOf(c) < loadOf(target)) target = c;
+            }
+            lastCpu[job] = target;
+            cpus[target].queue.push(entryOf(job));
+        }
+
+        // 4. Give every idle CPU work
+        for (int c = 0; c < m; ++c) {
+            if (cpus[c].running != -1) continue;
+            int job = takeWork(c);
+            if (job != -1) start(c, job);
+        }
+
+        // 5. Preemption check: only an arrival can displace a running job
+        if (!preemptive || !arrivedNow) continue;
+        if (perCpu) {
+            for (int c = 0; c < m; ++c) {
+                Cpu& cpu = cpus[c];
+                if (cpu.running == -1 || cpu.queue.empty() || !(cpu.queue.top() < runningEntry(c))) continue;
+                SCHED_TRACE(Preempt, currentTime, cpu.running, c);
+                cpu.queue.push(entryOf(stop(c)));
+                start(c, cpu.queue.pop().slot);
+                stats.preemptions++;
+            }
+        } else {
+            while (!globalQueue.empty()) {
+                int worst = -1;
+                for (int c = 0; c < m; ++c) {
+                    if (cpus[c].running != -1 && (worst == -1 || runningEntry(worst) < runningEntry(c))) worst = c;
+                }
+                if (worst == -1 || !(globalQueue.top() < runningEntry(worst))) break;
+                SCHED_TRACE(Preempt, currentTime, cpus[worst].running, worst);
+                globalQueue.push(entryOf(stop(worst)));
+                start(worst, globalQueue.pop().slot);
+                stats.preemptions++;
+            }
+        }
+    }
+
+    stats.makespan = currentTime;
+    stats.averageTurnaround = completed > 0 ? totalTurnaroundTime / completed : 0.0;
+    for (const Cpu& cpu : cpus) {
+        stats.utilization.push_back(stats.makespan > 0 ? static_cast<double>(cpu.busy) / stats.makespan : 0.0);
+    }
+    return stats;
+}
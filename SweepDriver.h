@@ -0,0 +1,244 @@
+// Command-line configuration and machine-readable output of the parameter
+// sweep in geminiversion.cpp. Every setting has a --key=value flag, and lists
+// are comma-separated; a point is swept for every (n, k, v_pct, d)
+// combination:
+//
+//   geminiversion --algorithms=fifo,srt --n=50,100 --k=1000 --v_pct=0.3
+//                 --d_factors=0.5,1,2 --replications=30 --seed=7 --threads=8
+//                 --csv=results.csv --json=results.json
+//
+//   --algorithms    fifo, sjf, srt (default: all three, in that order)
+//   --n, --k        job counts and max arrival times (k may be 0, every job
+//                   arriving at t=0; then give --d, as k/n is 0)
+//   --v_pct         burst standard deviation as a fraction of d
+//   --d_factors     mean burst relative to the mean arrival interval k/n
+//   --d             absolute mean bursts, used instead of --d_factors
+//   --replications  independent workloads per point
+//   --seed          master seed of every replication's RNG stream
+//   --threads       worker threads (default: one per hardware thread)
+//   --csv, --json   result files, one record per (point, algorithm)
+//
+// Each record holds the ATT summary, tt_p99 (the 99th percentile turnaround
+// over every job of the point's replications, from the pooled histograms of
+// LatencyHistogram.h) and sim_s, the time spent simulating that
+// algorithm summed over the point's replications, with the events per second
+// it amounts to (an arrival and a completion per job, as in Benchmark.cpp).
+// Replications run concurrently, so sim_s is CPU time across workers, not
+// elapsed time; wall_s, the wall-clock time of the whole sweep, is the JSON's
+// top-level field and a CSV column repeated on every row.
+// Algorithms share each replication's arrival sort, which is timed with the
+// first of them.
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <cstdlib>
+#include <cstdint>
+
+#include "SweepRunner.h"
+
+// --- Algorithms ---
+enum class SweepAlgorithm { Fifo, Sjf, Srt };
+
+inline const char* sweepAlgorithmName(SweepAlgorithm algorithm) {
+    switch (algorithm) {
+        case SweepAlgorithm::Fifo: return "FIFO";
+        case SweepAlgorithm::Sjf: return "SJF";
+        case SweepAlgorithm::Srt: return "SRT";
+    }
+    return "?";
+}
+
+// --- Sweep Configuration ---
+// The defaults are the sweep geminiversion runs without arguments.
+struct SweepConfig {
+    std::vector<SweepAlgorithm> algorithms = { SweepAlgorithm::Fifo, SweepAlgorithm::Sjf, SweepAlgorithm::Srt };
+    std::vector<int> nValues = { 50 };
+    std::vector<int> kValues = { 1000 };
+    std::vector<double> vPercentages = { 1.0 };
+    std::vector<double> dFactors = { 0.1, 0.5, 1.0, 2.0, 5.0, 10.0 };
+    std::vector<double> dValues;  // Absolute d; replaces dFactors when set
+    int replications = 30;
+    uint64_t seed = 20240501;
+    unsigned threads = 0;         // 0: one per hardware thread
+    std::string csvPath;
+    std::string jsonPath;
+};
+
+// Every point of the grid, in the order the sweep reports them
+inline std::vector<SweepPoint> sweepPoints(const SweepConfig& config) {
+    std::vector<SweepPoint> points;
+    for (int n : config.nValues) {
+        for (int k : config.kValues) {
+            double avg_arrival_interval = static_cast<double>(k) / n;
+            for (double v_percentage : config.vPercentages) {
+                if (!config.dValues.empty()) {
+                    for (double d : config.dValues) points.push_back({d, v_percentage, n, k});
+                } else {
+                    for (double factor : config.dFactors) {
+                        points.push_back({avg_arrival_interval * factor, v_percentage, n, k});
+                    }
+                }
+            }
+        }
+    }
+    return points;
+}
+
+// "a,b,c" -> {"a", "b", "c"}; empty items are kept so they can be rejected
+inline std::vector<std::string> splitSweepList(const std::string& value) {
+    std::vector<std::string> items;
+    size_t first = 0;
+    while (true) {
+        size_t comma = value.find(',', first);
+        items.push_back(value.substr(first, comma == std::string::npos ? std::string::npos : comma - first));
+        if (comma == std::string::npos) return items;
+        first = comma + 1;
+    }
+}
+
+// Applies one "--key=value" argument
+inline bool setSweepOption(SweepConfig& config, const std::string& arg) {
+    size_t eq = arg.find('=');
+    if (arg.compare(0, 2, "--") != 0 || eq == std::string::npos) {
+        std::cerr << "Error: expected --key=value, got " << arg << std::endl;
+        return false;
+    }
+    const std::string key = arg.substr(2, eq - 2);
+    const std::string value = arg.substr(eq + 1);
+
+    // Comma-separated lists; every item must parse completely
+    const std::vector<std::string> items = splitSweepList(value);
+    auto ints = [&](std::vector<int>& out, long min) {
+        out.clear();
+        for (const std::string& item : items) {
+            char* end = nullptr;
+            long x = std::strtol(item.c_str(), &end, 10);
+            if (item.empty() || *end != '\0' || x < min || x > std::numeric_limits<int>::max()) return false;
+            out.push_back(static_cast<int>(x));
+        }
+        return true;
+    };
+    auto numbers = [&](std::vector<double>& out) {
+        out.clear();
+        for (const std::string& item : items) {
+            char* end = nullptr;
+            double x = std::strtod(item.c_str(), &end);
+            if (item.empty() || *end != '\0' || !(x >= 0)) return false;
+            out.push_back(x);
+        }
+        return true;
+    };
+    auto integer = [&](long long& out) {
+        char* end = nullptr;
+        out = std::strtoll(value.c_str(), &end, 10);
+        return !value.empty() && *end == '\0';
+    };
+
+    bool ok = true;
+    long long i = 0;
+    if (key == "algorithms") {
+        config.algorithms.clear();
+        for (const std::string& name : items) {
+            if (name == "fifo") config.algorithms.push_back(SweepAlgorithm::Fifo);
+            else if (name == "sjf") config.algorithms.push_back(SweepAlgorithm::Sjf);
+            else if (name == "srt") config.algorithms.push_back(SweepAlgorithm::Srt);
+            else ok = false;
+        }
+    } else if (key == "n") {
+        ok = ints(config.nValues, 1);
+    } else if (key == "k") {
+        ok = ints(config.kValues, 0);
+    } else if (key == "v_pct") {
+        ok = numbers(config.vPercentages);
+    } else if (key == "d_factors") {
+        ok = numbers(config.dFactors);
+        config.dValues.clear();
+    } else if (key == "d") {
+        ok = numbers(config.dValues);
+    } else if (key == "replications") {
+        ok = integer(i) && i > 0 && i <= 1000000;
+        config.replications = static_cast<int>(i);
+    } else if (key == "seed") {
+        char* end = nullptr;
+        config.seed = std::strtoull(value.c_str(), &end, 10);
+        ok = !value.empty() && *end == '\0';
+    } else if (key == "threads") {
+        ok = integer(i) && i >= 0 && i <= 4096;
+        config.threads = static_cast<unsigned>(i);
+    } else if (key == "csv") {
+        config.csvPath = value;
+        ok = !value.empty();
+    } else if (key == "json") {
+        config.jsonPath = value;
+        ok = !value.empty();
+    } else {
+        std::cerr << "Error: unknown sweep option --" << key << std::endl;
+        return false;
+    }
+    if (!ok) std::cerr << "Error: bad value for --" << key << ": " << value << std::endl;
+    return ok;
+}
+
+// --- Result Records ---
+struct SweepRecord {
+    SweepPoint point;
+    SweepAlgorithm algorithm;
+    Summary att;
+    double turnaroundP99; // Over every job of the point's replications
+    double simSeconds;    // Time simulating, summed over the point's (concurrent) replications
+};
+
+inline double eventsPerSecond(const SweepRecord& r, int replications) {
+    double events = 2.0 * r.point.n * replications;
+    return r.simSeconds > 0 ? events / r.simSeconds : 0.0;
+}
+
+inline bool writeSweepCsv(const std::string& path, const SweepConfig& config, unsigned threads,
+                          double wallSeconds, const std::vector<SweepRecord>& records) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: cannot write " << path << std::endl;
+        return false;
+    }
+    out << std::setprecision(10);
+    out << "algorithm,n,k,v_pct,d,replications,seed,threads,att_mean,att_sd,att_ci95,d_over_att,tt_p99,"
+        << "sim_s,events_per_s,wall_s\n";
+    for (const SweepRecord& r : records) {
+        out << sweepAlgorithmName(r.algorithm) << "," << r.point.n << "," << r.point.k << "," << r.point.vPct
+            << "," << r.point.d << "," << config.replications << "," << config.seed << "," << threads << ","
+            << r.att.mean << "," << r.att.stddev << "," << r.att.ci95 << ","
+            << (r.att.mean > 0 ? r.point.d / r.att.mean : 0.0) << "," << r.turnaroundP99 << ","
+            << r.simSeconds << ","
+            << eventsPerSecond(r, config.replications) << "," << wallSeconds << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+// The run's settings and the sweep's wall-clock time, then one object per record
+inline bool writeSweepJson(const std::string& path, const SweepConfig& config, unsigned threads,
+                           double wallSeconds, const std::vector<SweepRecord>& records) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: cannot write " << path << std::endl;
+        return false;
+    }
+    out << std::setprecision(10);
+    out << "{\"replications\":" << config.replications << ",\"seed\":" << config.seed
+        << ",\"threads\":" << threads << ",\"wall_s\":" << wallSeconds << ",\"results\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+        const SweepRecord& r = records[i];
+        out << (i ? "," : "") << "\n{\"algorithm\":\"" << sweepAlgorithmName(r.algorithm) << "\""
+            << ",\"n\":" << r.point.n << ",\"k\":" << r.point.k << ",\"v_pct\":" << r.point.vPct
+            << ",\"d\":" << r.point.d << ",\"att_mean\":" << r.att.mean << ",\"att_sd\":" << r.att.stddev
+            << ",\"att_ci95\":" << r.att.ci95 << ",\"d_over_att\":" << (r.att.mean > 0 ? r.point.d / r.att.mean : 0.0)
+            << ",\"tt_p99\":" << r.turnaroundP99 << ",\"sim_s\":" << r.simSeconds
+            << ",\"events_per_s\":" << eventsPerSecond(r, config.replications) << "}";
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
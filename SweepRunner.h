@@ -0,0 +1,278 @@
+// Parallel parameter sweep with Monte-Carlo replications.
+// Every (d, v_pct, n, k, replication) combination is one task. Tasks run on a
+// work-stealing pool, each with its own RNG stream derived from a master seed
+// and the task index, and results are reduced in task order afterwards, so
+// the output is the same whatever the thread count.
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+// --- Work-Stealing Pool ---
+// Tasks are dealt round-robin into one deque per worker. A worker takes from
+// the back of its own deque and, once it runs dry, steals from the front of
+// the others. The calling thread acts as worker 0; the other workers are
+// started once by the constructor and sleep between runs until the next
+// run's epoch is published, so a run costs a wake-up instead of a thread
+// spawn per worker. One run at a time: run must not be called concurrently
+// or from inside a task.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned threads = std::thread::hardware_concurrency())
+        : threads_(threads == 0 ? 1 : threads), queues_(threads_) {
+        for (unsigned w = 1; w < threads_; ++w) {
+            helpers_.emplace_back(&WorkStealingPool::serve, this, w);
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> guard(state_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& h : helpers_) h.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    unsigned threadCount() const { return threads_; }
+
+    // Runs task(taskIndex, workerIndex) for every taskIndex in [0, taskCount)
+    // and returns once all of them have finished.
+    void run(size_t taskCount, const std::function<void(size_t, unsigned)>& task) {
+        if (taskCount == 0) return;
+        for (size_t t = 0; t < taskCount; ++t) {
+            queues_[t % threads_].tasks.push_back(t);
+        }
+        {
+            std::lock_guard<std::mutex> guard(state_);
+            task_ = &task;
+            busy_ = threads_ - 1;
+            epoch_++;
+        }
+        wake_.notify_all();
+        work(0);
+
+        std::unique_lock<std::mutex> guard(state_);
+        done_.wait(guard, [&] { return busy_ == 0; });
+        task_ = nullptr;
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<size_t> tasks;
+    };
+
+    void work(unsigned self) {
+        size_t t;
+        while (takeOwn(queues_[self], t) || steal(queues_, self, t)) {
+            (*task_)(t, self);
+        }
+    }
+
+    // Helper thread: one pass of work() per epoch until the pool is destroyed
+    void serve(unsigned self) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> guard(state_);
+                wake_.wait(guard, [&] { return stopping_ || epoch_ != seen; });
+                if (stopping_) return;
+                seen = epoch_;
+            }
+            work(self);
+            std::lock_guard<std::mutex> guard(state_);
+            if (--busy_ == 0) done_.notify_one();
+        }
+    }
+
+    static bool takeOwn(WorkerQueue& q, size_t& t) {
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.tasks.empty()) return false;
+        t = q.tasks.back();
+        q.tasks.pop_back();
+        return true;
+    }
+
+    // No new tasks are created while running, so an empty sweep over all
+    // victims means the worker can retire.
+    static bool steal(std::vector<WorkerQueue>& queues, unsigned self, size_t& t) {
+        for (size_t i = 1; i < queues.size(); ++i) {
+            WorkerQueue& victim = queues[(self + i) % queues.size()];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                t = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    unsigned threads_;
+    std::vector<WorkerQueue> queues_;
+    std::vector<std::thread> helpers_;
+
+    // Run handshake, guarded by state_
+    std::mutex state_;
+    std::condition_variable wake_; // A new epoch or stopping_
+    std::condition_variable done_; // busy_ reached 0
+    const std::function<void(size_t, unsigned)>* task_ = nullptr;
+    uint64_t epoch_ = 0;           // Bumped once per run
+    unsigned busy_ = 0;            // Helpers still working on this epoch
+    bool stopping_ = false;
+};
+
+// --- Deterministic Seeding ---
+// SplitMix64 finalizer: decorrelates nearby inputs such as consecutive task indices.
+inline uint64_t splitMix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// std::seed_seq over two 32-bit words, producing the same state words, but
+// kept in place instead of in a heap-allocated vector
+class SeedPair {
+public:
+    using result_type = uint32_t;
+
+    SeedPair(uint32_t lo, uint32_t hi) : v_{lo, hi} {}
+
+    template <typename It>
+    void generate(It begin, It end) const {
+        const size_t n = static_cast<size_t>(end - begin);
+        if (n == 0) return;
+        std::fill(begin, end, 0x8b8b8b8bu);
+        const size_t s = 2;
+        const size_t t = n >= 623 ? 11 : n >= 68 ? 7 : n >= 39 ? 5 : n >= 7 ? 3 : (n - 1) / 2;
+        const size_t p = (n - t) / 2;
+        const size_t q = p + t;
+        const size_t m = std::max(s + 1, n);
+        auto get = [&](size_t k) { return static_cast<uint32_t>(begin[k % n]); };
+        auto set = [&](size_t k, uint32_t x) { begin[k % n] = x; };
+        for (size_t k = 0; k < m; ++k) {
+            uint32_t r1 = 1664525u * mix(get(k) ^ get(k + p) ^ get(k + n - 1));
+            uint32_t r2 = r1 + static_cast<uint32_t>(k == 0 ? s : k <= s ? k % n + v_[k - 1] : k % n);
+            set(k + p, get(k + p) + r1);
+            set(k + q, get(k + q) + r2);
+            set(k, r2);
+        }
+        for (size_t k = m; k < m + n; ++k) {
+            uint32_t r3 = 1566083941u * mix(get(k) + get(k + p) + get(k + n - 1));
+            uint32_t r4 = r3 - static_cast<uint32_t>(k % n);
+            set(k + p, get(k + p) ^ r3);
+            set(k + q, get(k + q) ^ r4);
+            set(k, r4);
+        }
+    }
+
+private:
+    static uint32_t mix(uint32_t x) { return x ^ (x >> 27); }
+
+    uint32_t v_[2];
+};
+
+// Seeds the RNG stream of one task from the master seed and the task index.
+inline std::mt19937 taskGenerator(uint64_t masterSeed, uint64_t taskIndex) {
+    uint64_t s = splitMix64(masterSeed ^ splitMix64(taskIndex));
+    SeedPair seq(static_cast<uint32_t>(s), static_cast<uint32_t>(s >> 32));
+    return std::mt19937(seq);
+}
+
+// --- Summary Statistics ---
+struct Summary {
+    double mean = 0.0;
+    double stddev = 0.0; // Sample standard deviation
+    double ci95 = 0.0;   // Half-width of the 95% confidence interval of the mean
+    size_t samples = 0;
+};
+
+// Two-sided 95% Student t critical value for the given degrees of freedom
+inline double tCritical95(size_t df) {
+    static const double table[] = {
+        0.0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df == 0) return 0.0;
+    if (df <= 30) return table[df];
+    if (df <= 60) return 2.000;
+    if (df <= 120) return 1.980;
+    return 1.960;
+}
+
+// Welford's algorithm over the samples in the order given
+inline Summary summarize(const std::vector<double>& samples) {
+    Summary s;
+    double m2 = 0.0;
+    for (double x : samples) {
+        s.samples++;
+        double delta = x - s.mean;
+        s.mean += delta / s.samples;
+        m2 += delta * (x - s.mean);
+    }
+    if (s.samples > 1) {
+        s.stddev = std::sqrt(m2 / (s.samples - 1));
+        s.ci95 = tCritical95(s.samples - 1) * s.stddev / std::sqrt(static_cast<double>(s.samples));
+    }
+    return s;
+}
+
+// --- Sweep Runner ---
+struct SweepPoint {
+    double d;     // Mean CPU burst time
+    double vPct;  // Burst standard deviation as a fraction of d
+    int n;        // Number of processes
+    int k;        // Max arrival time
+};
+
+// One replication: generates a workload for the point from gen and writes
+// its metrics (e.g. the ATT of each algorithm) into out[0 .. metricCount).
+// Each worker owns one Context and passes it to every replication it runs, so
+// buffers kept in it are reused from one replication to the next.
+template <typename Context>
+using ReplicationFn = std::function<void(const SweepPoint&, std::mt19937& gen, Context& context, double* out)>;
+
+// Runs `replications` tasks for every point and returns, per point, one
+// Summary per metric. If workerContexts is given it receives the workers'
+// contexts afterwards, e.g. to merge what they accumulated.
+template <typename Context>
+std::vector<std::vector<Summary>> runSweep(const std::vector<SweepPoint>& points, int replications,
+                                           size_t metricCount, uint64_t masterSeed, WorkStealingPool& pool,
+                                           const ReplicationFn<Context>& replicate,
+                                           std::vector<Context>* workerContexts = nullptr) {
+    const size_t taskCount = points.size() * replications;
+    std::vector<double> metrics(taskCount * metricCount);
+    std::vector<Context> contexts(pool.threadCount());
+
+    pool.run(taskCount, [&](size_t task, unsigned worker) {
+        std::mt19937 gen = taskGenerator(masterSeed, task);
+        replicate(points[task / replications], gen, contexts[worker], &metrics[task * metricCount]);
+    });
+    if (workerContexts) *workerContexts = std::move(contexts);
+
+    std::vector<std::vector<Summary>> results(points.size());
+    std::vector<double> samples(replications);
+    for (size_t p = 0; p < points.size(); ++p) {
+        for (size_t m = 0; m < metricCount; ++m) {
+            for (int r = 0; r < replications; ++r) {
+                samples[r] = metrics[(p * replications + r) * metricCount + m];
+            }
+            results[p].push_back(summarize(samples));
+        }
+    }
+    return results;
+}
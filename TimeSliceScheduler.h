@@ -0,0 +1,245 @@
+// Time-slice schedulers for interactive workloads: Round-Robin and a
+// multi-level feedback queue (MLFQ), driven by the same job stores as the
+// event engine (EventEngine.h).
+//
+// Round-Robin: one level; a job runs for at most `quantum` time units, then
+//              goes to the back of the queue behind jobs that arrived by then.
+// MLFQ:        `levels` levels, level l with quantum * quantumGrowth^l. Jobs
+//              arrive at the top level and drop one level each time they use
+//              up a full slice there; an arrival preempts a job running at a
+//              lower level, which keeps the part of its slice already used.
+//              Every boostPeriod time units all jobs return to the top level,
+//              so long jobs are not starved.
+// Within a level jobs are served in FIFO order. Non-empty levels are tracked
+// in a 64-bit bitmap, so finding the highest waiting level, pushing and
+// popping are all O(1) regardless of the number of levels or jobs.
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+#include "EventEngine.h"
+#include "ReadyQueue.h"
+#include "SchedTrace.h"
+#include "Workload.h"
+
+// --- Configuration ---
+struct TimeSliceConfig {
+    int levels = 1;              // 1 = Round-Robin, at most kMaxLevels
+    int quantum = 10;            // Slice length at the top level
+    int quantumGrowth = 2;       // Each lower level multiplies the slice by this
+    long long boostPeriod = 0;   // MLFQ priority boost interval, 0 = never
+};
+
+constexpr int kMaxLevels = 64; // One bit per level
+
+inline TimeSliceConfig roundRobinConfig(int quantum) {
+    TimeSliceConfig config;
+    config.quantum = quantum;
+    return config;
+}
+
+inline TimeSliceConfig mlfqConfig(int levels, int quantum, long long boostPeriod) {
+    TimeSliceConfig config;
+    config.levels = levels;
+    config.quantum = quantum;
+    config.boostPeriod = boostPeriod;
+    return config;
+}
+
+// Counters of what the scheduler did in the last run
+struct TimeSliceCounters {
+    size_t expirations = 0; // Slices used up
+    size_t demotions = 0;   // Expirations that moved a job down a level
+    size_t preemptions = 0; // Jobs displaced by a higher-level arrival
+    size_t boosts = 0;
+};
+
+// --- Bitmap-Indexed Levels ---
+// One FIFO ring per level (level 0 is the highest priority) plus a bitmap of
+// the non-empty ones; the best level is the lowest set bit.
+class LevelQueues {
+public:
+    explicit LevelQueues(int levels = 1) : queues_(levels) {}
+
+    void push(int level, ReadyEntry entry) {
+        queues_[level].push(entry);
+        nonEmpty_ |= uint64_t(1) << level;
+    }
+
+    // Highest-priority non-empty level; must not be empty()
+    int topLevel() const { return __builtin_ctzll(nonEmpty_); }
+
+    ReadyEntry pop() { return popFrom(topLevel()); }
+
+    ReadyEntry popFrom(int level) {
+        ReadyEntry front = queues_[level].pop();
+        if (queues_[level].empty()) nonEmpty_ &= ~(uint64_t(1) << level);
+        return front;
+    }
+
+    bool empty() const { return nonEmpty_ == 0; }
+    bool emptyAt(int level) const { return !(nonEmpty_ >> level & 1); }
+
+    void clear() {
+        for (FifoReadyQueue& q : queues_) q.clear();
+        nonEmpty_ = 0;
+    }
+
+private:
+    std::vector<FifoReadyQueue> queues_;
+    uint64_t nonEmpty_ = 0;
+};
+
+// --- Time-Slice Simulation ---
+// Like Simulator<Policy>, time jumps from event to event: completions, slice
+// expirations and, with more than one level, arrivals and boosts (the only
+// moments a running job can be displaced). Per-slot level and slice usage
+// and the level queues are kept between runs.
+//
+// This is not a Policy of Simulator<Policy>: a policy there is a fixed key
+// per job and a ready queue ordered by it, with preemption checked only when
+// jobs arrive. Here a job's place depends on its history (level, slice used),
+// the running job is also displaced by the clock (slice expiry, boost), and
+// an expired job must queue behind jobs arriving at the same instant, none of
+// which fits a (key, id) order.
+class TimeSliceSimulator {
+public:
+    explicit TimeSliceSimulator(const TimeSliceConfig& config)
+        : config_(config), levels_(levelCountOf(config)) {
+        const long long growth = std::max(1, config.quantumGrowth);
+        long long quantum = std::max(1, config.quantum);
+        for (int l = 0; l < levelCountOf(config); ++l) {
+            quanta_.push_back(quantum);
+            quantum = quantum > kMaxQuantum / growth ? kMaxQuantum : quantum * growth; // Saturates, never wraps
+        }
+    }
+
+    template <typename Jobs>
+    void run(Jobs& jobs) {
+        const long long never = std::numeric_limits<long long>::max();
+        const int levelCount = static_cast<int>(quanta_.size());
+        const bool multiLevel = levelCount > 1;
+        const long long boost = multiLevel && config_.boostPeriod > 0 ? config_.boostPeriod : 0;
+        long long nextBoost = boost > 0 ? boost : never;
+        int running = -1; // Slot of the job on the CPU, -1 if idle
+        int expired = -1; // Job whose slice just ran out, waiting to be requeued
+        long long currentTime = 0;
+        levels_.clear();
+        counters_ = TimeSliceCounters();
+        SCHED_TRACE_RUN();
+
+        auto entryOf = [&](int slot) { return ReadyEntry{0, jobs.id(slot), slot}; };
+        auto promote = [&](int slot) {
+            level_[slot] = 0;
+            used_[slot] = 0;
+        };
+
+        for (;;) {
+            // 1. Priority boost: every job, waiting or not, returns to the top level
+            if (currentTime >= nextBoost) {
+                for (int l = 1; l < levelCount; ++l) {
+                    while (!levels_.emptyAt(l)) {
+                        ReadyEntry e = levels_.popFrom(l);
+                        promote(e.slot);
+                        levels_.push(0, e);
+                    }
+                }
+                if (running != -1) promote(running);
+                if (expired != -1) promote(expired);
+                nextBoost = (currentTime / boost + 1) * boost;
+                counters_.boosts++;
+            }
+
+            // 2. Admit every job that has arrived by now at the top level
+            bool arrivedNow = false;
+            while (jobs.hasArrivedBy(currentTime)) {
+                int slot = jobs.admit();
+                if (slot >= static_cast<int>(level_.size())) {
+                    level_.resize(slot + 1);
+                    used_.resize(slot + 1);
+                }
+                promote(slot);
+                SCHED_TRACE(Arrival, jobs.arrival(slot), jobs.id(slot), 0);
+                levels_.push(0, entryOf(slot));
+                arrivedNow = true;
+            }
+
+            // 3. A job whose slice ran out queues behind the jobs arriving now
+            if (expired != -1) {
+                levels_.push(level_[expired], entryOf(expired));
+                expired = -1;
+            }
+
+            // 4. Preemption check: an arrival outranks a job on a lower level
+            if (arrivedNow && running != -1 && levels_.topLevel() < level_[running]) {
+                SCHED_TRACE(Preempt, currentTime, jobs.id(running), 0);
+                levels_.push(level_[running], entryOf(running));
+                running = -1;
+                counters_.preemptions++;
+            }
+
+            // 5. Dispatch, or jump straight to the next arrival if nothing is ready
+            if (running == -1) {
+                if (levels_.empty()) {
+                    currentTime = jobs.nextArrivalTime();
+                    if (currentTime == never) break; // All jobs done
+                    continue;
+                }
+                running = levels_.pop().slot;
+                SCHED_TRACE(Dispatch, currentTime, jobs.id(running), 0);
+                if constexpr (HasDispatchHook<Jobs>::value) jobs.dispatch(running, currentTime);
+            }
+
+            // 6. Advance to completion, the end of the slice, or an arrival or
+            //    boost that may displace the job
+            int& remaining = jobs.remaining(running);
+            long long finishTime = currentTime + remaining;
+            long long sliceEnd = currentTime + quanta_[level_[running]] - used_[running];
+            long long next = std::min(finishTime, sliceEnd);
+            if (multiLevel) next = std::min(next, std::min(jobs.nextArrivalTime(), nextBoost));
+            remaining -= static_cast<int>(next - currentTime);
+            used_[running] += next - currentTime;
+            currentTime = next;
+            if (remaining == 0) {
+                SCHED_TRACE(Complete, currentTime, jobs.id(running), 0);
+                jobs.complete(running, currentTime);
+                running = -1;
+            } else if (used_[running] >= quanta_[level_[running]]) {
+                if (level_[running] + 1 < levelCount) {
+                    level_[running]++;
+                    counters_.demotions++;
+                }
+                used_[running] = 0;
+                SCHED_TRACE(Expire, currentTime, jobs.id(running), 0);
+                expired = running;
+                running = -1;
+                counters_.expirations++;
+            }
+        }
+    }
+
+    // Simulates a whole workload, filling in remainingCpuTime and completionTime
+    void run(Workload& w) {
+        w.reset();
+        WorkloadJobs jobs(w);
+        run(jobs);
+    }
+
+    const TimeSliceCounters& counters() const { return counters_; }
+
+private:
+    static constexpr long long kMaxQuantum = 1LL << 40; // Keeps deep levels from overflowing
+
+    static int levelCountOf(const TimeSliceConfig& config) { return std::max(1, std::min(config.levels, kMaxLevels)); }
+
+    TimeSliceConfig config_;
+    std::vector<long long> quanta_; // Slice length per level
+    LevelQueues levels_;
+    std::vector<int> level_;        // Current level, indexed by slot
+    std::vector<long long> used_;   // Time used of the current slice, indexed by slot
+    TimeSliceCounters counters_;
+};
@@ -0,0 +1,287 @@
+// Streaming replay of batch-job traces through the event engine.
+// A trace is a sequence of (id, arrival, burst) records sorted by arrival
+// time, either as CSV text or as a binary file read through mmap. Jobs are
+// pulled from the file only when the simulation clock reaches them and are
+// forgotten once they complete, so memory is bounded by the number of live
+// (arrived, unfinished) jobs rather than by the length of the trace.
+//
+// CSV:    one "id,arrival,burst" line per job after an optional header line;
+//         blank lines and '#' comments are skipped, any other bad line is an
+//         error.
+// Binary: the 8-byte magic "SSTRACE1", then packed BinaryTraceRecord structs
+//         in native byte order.
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "EventEngine.h"
+#include "LatencyHistogram.h"
+#include "OnlineScheduler.h"
+#include "Workload.h"
+
+// --- Trace Records ---
+struct JobRecord {
+    int id;
+    long long arrival;
+    int burst;
+};
+
+struct BinaryTraceRecord {
+    int64_t arrival;
+    int32_t id;
+    int32_t burst;
+};
+
+constexpr char kBinaryTraceMagic[8] = {'S', 'S', 'T', 'R', 'A', 'C', 'E', '1'};
+
+// --- CSV Reader ---
+// The first line is skipped if it is a header (does not start with a number);
+// blank lines and '#' comments are skipped anywhere. Every other line must be
+// exactly "id,arrival,burst" with id and burst in int range and burst >= 1;
+// anything else is reported with its line number and ends the trace.
+class CsvTraceReader {
+public:
+    explicit CsvTraceReader(const std::string& path) : in_(path), ok_(static_cast<bool>(in_)) {
+        if (!ok_) std::cerr << "Error: cannot open trace " << path << std::endl;
+    }
+
+    bool ok() const { return ok_; }
+
+    // Reads the next job; false at end of file or on a malformed line
+    bool next(JobRecord& job) {
+        while (ok_ && std::getline(in_, line_)) {
+            lineNumber_++;
+            const char* p = line_.c_str();
+            while (*p == ' ' || *p == '\t') ++p;
+            if (*p == '\0' || *p == '\r' || *p == '#') continue; // Blank line or comment
+            bool number = std::isdigit(static_cast<unsigned char>(*p)) || *p == '-' || *p == '+';
+            if (lineNumber_ == 1 && !number) continue;             // Header
+
+            long long id, arrival, burst;
+            if (!field(p, id, ',') || !field(p, arrival, ',') || !field(p, burst, '\0')) return malformed();
+            if (id < std::numeric_limits<int>::min() || id > std::numeric_limits<int>::max() || burst < 1 ||
+                burst > std::numeric_limits<int>::max()) {
+                return malformed();
+            }
+            job.id = static_cast<int>(id);
+            job.arrival = arrival;
+            job.burst = static_cast<int>(burst);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    // Parses one integer at p followed by `separator` ('\0': end of line,
+    // trailing blanks allowed) and moves p past it
+    static bool field(const char*& p, long long& value, char separator) {
+        char* end;
+        errno = 0;
+        value = std::strtoll(p, &end, 10);
+        if (end == p || errno == ERANGE) return false;
+        if (separator != '\0') {
+            if (*end != separator) return false;
+            p = end + 1;
+            return true;
+        }
+        while (*end == ' ' || *end == '\t' || *end == '\r') ++end;
+        return *end == '\0';
+    }
+
+    bool malformed() {
+        std::cerr << "Error: malformed trace line " << lineNumber_ << ": " << line_ << std::endl;
+        ok_ = false;
+        return false;
+    }
+
+    std::ifstream in_;
+    std::string line_;
+    size_t lineNumber_ = 0;
+    bool ok_;
+};
+
+// --- Binary Reader (mmap) ---
+// Records are decoded straight from the mapping. Pages behind the cursor are
+// dropped every kReleaseBytes so a multi-GB trace does not stay resident.
+class BinaryTraceReader {
+public:
+    explicit BinaryTraceReader(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0) {
+            std::cerr << "Error: cannot open trace " << path << std::endl;
+            if (fd >= 0) ::close(fd);
+            return;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ >= sizeof kBinaryTraceMagic) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                base_ = static_cast<const char*>(p);
+                ::madvise(p, size_, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+        if (!base_ || std::memcmp(base_, kBinaryTraceMagic, sizeof kBinaryTraceMagic) != 0) {
+            std::cerr << "Error: " << path << " is not a binary trace" << std::endl;
+            unmap();
+            return;
+        }
+        cursor_ = released_ = sizeof kBinaryTraceMagic;
+    }
+
+    ~BinaryTraceReader() { unmap(); }
+    BinaryTraceReader(const BinaryTraceReader&) = delete;
+    BinaryTraceReader& operator=(const BinaryTraceReader&) = delete;
+
+    bool ok() const { return base_ != nullptr && !truncated_; }
+
+    bool next(JobRecord& job) {
+        if (!base_ || cursor_ == size_) return false;
+        if (cursor_ + sizeof(BinaryTraceRecord) > size_) {
+            if (!truncated_) std::cerr << "Error: binary trace truncated in its last record" << std::endl;
+            truncated_ = true;
+            return false;
+        }
+        BinaryTraceRecord r;
+        std::memcpy(&r, base_ + cursor_, sizeof r);
+        cursor_ += sizeof r;
+        job.id = r.id;
+        job.arrival = r.arrival;
+        job.burst = r.burst;
+        if (cursor_ - released_ >= kReleaseBytes) release();
+        return true;
+    }
+
+private:
+    static constexpr size_t kReleaseBytes = size_t(64) << 20;
+
+    // Tells the kernel the consumed, page-aligned prefix is no longer needed
+    void release() {
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t end = cursor_ / page * page;
+        size_t begin = released_ / page * page;
+        if (end > begin) {
+            ::madvise(const_cast<char*>(base_) + begin, end - begin, MADV_DONTNEED);
+        }
+        released_ = cursor_;
+    }
+
+    void unmap() {
+        if (base_) ::munmap(const_cast<char*>(base_), size_);
+        base_ = nullptr;
+    }
+
+    const char* base_ = nullptr;
+    size_t size_ = 0;
+    size_t cursor_ = 0;
+    size_t released_ = 0;
+    bool truncated_ = false;
+};
+
+// --- Trace Export ---
+// Writes a workload as a trace in (arrival, id) order, so generated workloads
+// can be replayed or shared.
+inline bool writeTrace(const std::string& path, const Workload& w, bool binary) {
+    ArrivalIndex order(w.arrivalTime);
+    std::ofstream out(path, binary ? std::ios::binary : std::ios::out);
+    if (!out) {
+        std::cerr << "Error: cannot write trace " << path << std::endl;
+        return false;
+    }
+    if (binary) {
+        out.write(kBinaryTraceMagic, sizeof kBinaryTraceMagic);
+    } else {
+        out << "id,arrival,burst\n";
+    }
+    while (order.nextArrivalTime() != std::numeric_limits<long long>::max()) {
+        int i = order.next();
+        if (binary) {
+            BinaryTraceRecord r{w.arrivalTime[i], i, w.totalCpuTime[i]};
+            out.write(reinterpret_cast<const char*>(&r), sizeof r);
+        } else {
+            out << i << ',' << w.arrivalTime[i] << ',' << w.totalCpuTime[i] << '\n';
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+// --- Trace Simulation ---
+struct TraceStats {
+    size_t completed = 0;
+    double totalTurnaroundTime = 0;
+    long long maxTurnaroundTime = 0;
+    size_t peakLiveJobs = 0; // Most jobs held in memory at once
+    bool ok = true;          // False if the trace could not be read completely
+    LatencyDistribution latency; // Turnaround, waiting and slowdown tails
+
+    double averageTurnaround() const { return completed > 0 ? totalTurnaroundTime / completed : 0.0; }
+};
+
+// Feeds the trace into an OnlineScheduler (OnlineScheduler.h) one record at
+// a time, ticking the clock up to each arrival before submitting it. Stops at
+// the first record that arrives earlier than its predecessor.
+template <typename Reader>
+TraceStats simulateTrace(Reader& reader, QueueKey key, bool preemptive) {
+    TraceStats stats;
+    withKeyPolicy(key, preemptive, [&](auto policy) {
+        OnlineScheduler<decltype(policy)> scheduler(policy);
+        auto collect = [&] {
+            CompletionEvent done;
+            while (scheduler.nextCompletion(done)) {
+                long long turnaround = done.time - done.arrival;
+                stats.completed++;
+                stats.totalTurnaroundTime += turnaround;
+                if (turnaround > stats.maxTurnaroundTime) stats.maxTurnaroundTime = turnaround;
+                stats.latency.record(done.arrival, done.burst, done.time);
+            }
+            DispatchEvent dispatched;
+            while (scheduler.nextDispatch(dispatched)) {} // Not needed for replay
+        };
+
+        JobRecord job;
+        while (reader.next(job)) {
+            scheduler.tickUntil(job.arrival);
+            collect();
+            if (!scheduler.submit(job.id, job.arrival, job.burst)) {
+                stats.ok = false;
+                break;
+            }
+        }
+        if (!reader.ok()) stats.ok = false;
+        scheduler.finish();
+        collect();
+        stats.peakLiveJobs = scheduler.peakLive();
+    });
+    return stats;
+}
+
+// Opens the trace at path (binary if it starts with the magic, CSV
+// otherwise) and replays it under one policy.
+inline TraceStats simulateTraceFile(const std::string& path, QueueKey key, bool preemptive) {
+    char magic[sizeof kBinaryTraceMagic] = {};
+    std::ifstream probe(path, std::ios::binary);
+    probe.read(magic, sizeof magic);
+    if (probe.gcount() == static_cast<std::streamsize>(sizeof magic) &&
+        std::memcmp(magic, kBinaryTraceMagic, sizeof magic) == 0) {
+        BinaryTraceReader reader(path);
+        return simulateTrace(reader, key, preemptive);
+    }
+    CsvTraceReader reader(path);
+    return simulateTrace(reader, key, preemptive);
+}
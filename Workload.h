@@ -0,0 +1,49 @@
+// Structure-of-arrays workload store. Each per-job field lives in its own
+// contiguous array, so the engine and the ATT reduction (SimdKernels.h)
+// stream through exactly the fields they touch, and simulators refer to jobs
+// by index. A job costs 20 bytes (4 + 4 + 4 + 8) with no padding, flags or
+// pointers.
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+// --- Workload Container ---
+struct Workload {
+    std::vector<int> arrivalTime;
+    std::vector<int> totalCpuTime;         // T_i (original burst time)
+    std::vector<int> remainingCpuTime;     // R_i
+    std::vector<long long> completionTime; // -1 until the job completes
+
+    size_t size() const { return arrivalTime.size(); }
+
+    void reserve(size_t n) {
+        arrivalTime.reserve(n);
+        totalCpuTime.reserve(n);
+        remainingCpuTime.reserve(n);
+        completionTime.reserve(n);
+    }
+
+    // Sizes every array for n jobs; callers fill arrivalTime and totalCpuTime
+    // and then call reset()
+    void resize(size_t n) {
+        arrivalTime.resize(n);
+        totalCpuTime.resize(n);
+        remainingCpuTime.resize(n);
+        completionTime.resize(n);
+    }
+
+    // Appends a job; its id is its index
+    void add(int arrival, int cpu) {
+        arrivalTime.push_back(arrival);
+        totalCpuTime.push_back(cpu);
+        remainingCpuTime.push_back(cpu);
+        completionTime.push_back(-1);
+    }
+
+    // Restores the state before any simulation ran, keeping the job set
+    void reset() {
+        remainingCpuTime.assign(totalCpuTime.begin(), totalCpuTime.end());
+        completionTime.assign(size(), -1);
+    }
+};
@@ -0,0 +1,244 @@
+// Compact, versioned workload files, so FIFO/SJF/SRT comparisons across runs
+// and across machines can use exactly the same input.
+//
+// Layout (native byte order):
+//   WorkloadFileHeader  fixed 64 bytes: magic "SSWLOAD1", version, job count,
+//                       generator parameters n, k, d, v and seed, and the
+//                       arrival time of the first job
+//   body                per job, in (arrival, id) order: LEB128 varint of the
+//                       arrival delta to the previous job, then a LEB128
+//                       varint of the burst time
+// Jobs are renumbered in arrival order when saved, so job i of a loaded
+// workload is the i-th arrival. Typical workloads take 2-3 bytes per job.
+//
+// Opening a file only maps it and validates the header. Jobs are decoded from
+// the mapping as they are consumed, either streamed straight into the event
+// engine (WorkloadFileReader works with simulateTrace() in TraceReader.h) or
+// unpacked into a Workload by loadWorkload().
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "EventEngine.h"
+#include "Workload.h"
+#include "TraceReader.h"
+
+// --- File Header ---
+constexpr char kWorkloadFileMagic[8] = {'S', 'S', 'W', 'L', 'O', 'A', 'D', '1'};
+constexpr uint32_t kWorkloadFileVersion = 1;
+
+struct WorkloadFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerBytes;  // sizeof(WorkloadFileHeader), for forward compatibility
+    uint64_t jobCount;
+    int64_t k;             // Max arrival time the generator used
+    double d;              // Mean CPU burst time
+    double v;              // Burst standard deviation
+    uint64_t seed;         // Seed the generator was run with
+    int64_t firstArrival;  // Arrival time the first delta is relative to
+};
+static_assert(sizeof(WorkloadFileHeader) == 64, "workload header must stay 64 bytes");
+
+// Generator parameters recorded in the header
+struct WorkloadParams {
+    int k = 0;
+    double d = 0.0;
+    double v = 0.0;
+    uint64_t seed = 0;
+};
+
+// --- Varint Coding ---
+inline void putVarint(std::vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+// Decodes one varint at p, never reading at or past end; false if truncated
+inline bool getVarint(const unsigned char*& p, const unsigned char* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+        unsigned char byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+// --- Writer ---
+// Saves the workload's arrival and burst times; remaining and completion
+// times are not stored. The body is encoded and written in 1 MB chunks.
+inline bool saveWorkload(const std::string& path, const Workload& w, const WorkloadParams& params) {
+    ArrivalIndex order(w.arrivalTime);
+    WorkloadFileHeader header{};
+    std::memcpy(header.magic, kWorkloadFileMagic, sizeof header.magic);
+    header.version = kWorkloadFileVersion;
+    header.headerBytes = sizeof(WorkloadFileHeader);
+    header.jobCount = w.size();
+    header.k = params.k;
+    header.d = params.d;
+    header.v = params.v;
+    header.seed = params.seed;
+    header.firstArrival = w.size() > 0 ? order.nextArrivalTime() : 0;
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof header);
+    std::vector<unsigned char> chunk;
+    chunk.reserve((size_t(1) << 20) + 20);
+    long long previous = header.firstArrival;
+    for (size_t j = 0; j < w.size() && out; ++j) {
+        int i = order.next();
+        putVarint(chunk, static_cast<uint64_t>(w.arrivalTime[i] - previous));
+        putVarint(chunk, static_cast<uint64_t>(w.totalCpuTime[i]));
+        previous = w.arrivalTime[i];
+        if (chunk.size() >= (size_t(1) << 20) || j + 1 == w.size()) {
+            out.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    if (!out) {
+        std::cerr << "Error: cannot write workload " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// --- Reader (mmap) ---
+// Maps the file and decodes jobs on demand. Satisfies the reader interface
+// of TraceReader.h, so a saved workload can be streamed like any trace.
+class WorkloadFileReader {
+public:
+    explicit WorkloadFileReader(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0) {
+            std::cerr << "Error: cannot open workload " << path << std::endl;
+            if (fd >= 0) ::close(fd);
+            return;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ >= sizeof(WorkloadFileHeader)) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                base_ = static_cast<const unsigned char*>(p);
+                ::madvise(p, size_, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+        if (base_) std::memcpy(&header_, base_, sizeof header_);
+        if (!base_ || std::memcmp(header_.magic, kWorkloadFileMagic, sizeof header_.magic) != 0) {
+            std::cerr << "Error: " << path << " is not a workload file" << std::endl;
+            unmap();
+            return;
+        }
+        if (header_.version != kWorkloadFileVersion) {
+            std::cerr << "Error: " << path << " has unsupported workload version "
+                      << header_.version << std::endl;
+            unmap();
+            return;
+        }
+        if (header_.headerBytes < sizeof(WorkloadFileHeader) || header_.headerBytes > size_) {
+            std::cerr << "Error: " << path << " has a corrupt header (header size "
+                      << header_.headerBytes << " in a " << size_ << "-byte file)" << std::endl;
+            unmap();
+            return;
+        }
+        // Every job takes at least two bytes, so a larger count is corrupt;
+        // checking it here keeps loadWorkload() from sizing arrays off it
+        if (header_.jobCount > (size_ - header_.headerBytes) / 2 ||
+            header_.firstArrival < std::numeric_limits<int>::min() ||
+            header_.firstArrival > std::numeric_limits<int>::max()) {
+            std::cerr << "Error: " << path << " has a corrupt header (" << header_.jobCount << " jobs in "
+                      << size_ - header_.headerBytes << " body bytes)" << std::endl;
+            unmap();
+            return;
+        }
+        cursor_ = base_ + header_.headerBytes;
+        end_ = base_ + size_;
+        previous_ = header_.firstArrival;
+    }
+
+    ~WorkloadFileReader() { unmap(); }
+    WorkloadFileReader(const WorkloadFileReader&) = delete;
+    WorkloadFileReader& operator=(const WorkloadFileReader&) = delete;
+
+    bool ok() const { return base_ != nullptr && !failed_; }
+    const WorkloadFileHeader& header() const { return header_; }
+
+    bool next(JobRecord& job) {
+        if (!base_ || failed_ || decoded_ == header_.jobCount) return false;
+        uint64_t delta, burst;
+        if (!getVarint(cursor_, end_, delta) || !getVarint(cursor_, end_, burst)) {
+            std::cerr << "Error: workload file truncated after " << decoded_ << " jobs" << std::endl;
+            failed_ = true;
+            return false;
+        }
+        // Saved workloads hold int times; anything wider is corruption
+        const long long maxInt = std::numeric_limits<int>::max();
+        if (delta > static_cast<uint64_t>(maxInt - previous_) || burst > static_cast<uint64_t>(maxInt)) {
+            std::cerr << "Error: workload file has an out-of-range job " << decoded_ << std::endl;
+            failed_ = true;
+            return false;
+        }
+        previous_ += static_cast<long long>(delta);
+        job.id = static_cast<int>(decoded_++);
+        job.arrival = previous_;
+        job.burst = static_cast<int>(burst);
+        return true;
+    }
+
+private:
+    void unmap() {
+        if (base_) ::munmap(const_cast<unsigned char*>(base_), size_);
+        base_ = nullptr;
+    }
+
+    WorkloadFileHeader header_{};
+    const unsigned char* base_ = nullptr;
+    const unsigned char* cursor_ = nullptr;
+    const unsigned char* end_ = nullptr;
+    size_t size_ = 0;
+    uint64_t decoded_ = 0;
+    long long previous_ = 0;
+    bool failed_ = false;  // Truncated or corrupt body
+};
+
+// Unpacks a saved workload into w; header receives the file header if given
+inline bool loadWorkload(const std::string& path, Workload& w, WorkloadFileHeader* header = nullptr) {
+    WorkloadFileReader reader(path);
+    if (!reader.ok()) return false;
+    if (header) *header = reader.header();
+    w.resize(reader.header().jobCount);
+    JobRecord job;
+    for (size_t i = 0; i < w.size(); ++i) {
+        if (!reader.next(job)) return false;
+        w.arrivalTime[i] = static_cast<int>(job.arrival);
+        w.totalCpuTime[i] = job.burst;
+    }
+    w.reset();
+    return true;
+}
+
+// True if the file at path starts with the workload file magic
+inline bool isWorkloadFile(const std::string& path) {
+    char magic[sizeof kWorkloadFileMagic] = {};
+    std::ifstream probe(path, std::ios::binary);
+    probe.read(magic, sizeof magic);
+    return probe.gcount() == static_cast<std::streamsize>(sizeof magic) &&
+           std::memcmp(magic, kWorkloadFileMagic, sizeof magic) == 0;
+}
@@ -0,0 +1,335 @@
+// Configurable workload generator. The arrival process and the job-size
+// distribution are chosen by name, so bursty traffic and heavy-tailed sizes
+// can be simulated next to the uniform/normal workloads of generateWorkload()
+// in SimdKernels.h:
+//
+//   arrivals  uniform    uniform on [0, max_arrival]
+//             poisson    exponential gaps at `rate` jobs per time unit
+//             mmpp       Markov-modulated Poisson: `rate` in the calm state,
+//                        `burst_rate` in the bursty one, with exponentially
+//                        distributed stays of mean calm_time / burst_time
+//   sizes     normal     mean, stddev
+//             exponential  mean
+//             pareto     mean, alpha (> 1): heavy tail, P(X > x) ~ x^-alpha
+//             lognormal  mean, sigma of the underlying normal
+// Sizes are rounded to the nearest integer, at least 1 and at most
+// kMaxGeneratedSize; arrival times are truncated to integers.
+//
+// Options are set as key=value pairs, one per command-line argument or one
+// per line of a config file ('#' starts a comment):
+//
+//   jobs = 1000000
+//   seed = 7
+//   arrivals = mmpp
+//   rate = 0.02
+//   burst_rate = 0.2
+//   calm_time = 5000
+//   burst_time = 500
+//   sizes = pareto
+//   mean = 20
+//   alpha = 1.5
+//
+// Jobs are generated in chunks of `chunk` jobs on a WorkStealingPool. Every
+// chunk draws from its own RNG streams, seeded from the seed and the chunk
+// index like the sweep's tasks (see taskGenerator()), so the workload depends
+// only on the options, never on the thread count. Arrival times are a prefix
+// sum over chunks: a first pass measures how long each chunk's arrivals span,
+// and a second pass regenerates every chunk from the same streams, offset by
+// the spans before it. An MMPP chunk starts in a state drawn from the chain's
+// stationary distribution, so bursts do not carry across chunk boundaries;
+// with the default 65536-job chunks a burst would have to outlast a whole
+// chunk for this to matter.
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstddef>
+
+#include "SimdKernels.h"
+#include "SweepRunner.h"
+#include "Workload.h"
+
+constexpr int kMaxGeneratedSize = 1 << 30;
+
+// --- Generator Options ---
+enum class ArrivalProcess { Uniform, Poisson, Mmpp };
+enum class SizeDistribution { Normal, Exponential, Pareto, Lognormal };
+
+struct GeneratorConfig {
+    int jobs = 1000;
+    uint64_t seed = 1;
+    size_t chunk = 65536;         // Jobs per chunk; part of the output, not a tuning knob
+
+    ArrivalProcess arrivals = ArrivalProcess::Uniform;
+    int maxArrival = 2000;        // uniform: k
+    double rate = 0.5;            // poisson; mmpp in the calm state
+    double burstRate = 5.0;       // mmpp in the bursty state
+    double calmTime = 1000.0;     // mmpp: mean stay in the calm state
+    double burstTime = 100.0;     // mmpp: mean stay in the bursty state
+
+    SizeDistribution sizes = SizeDistribution::Normal;
+    double mean = 20.0;           // d
+    double stddev = 6.0;          // normal: v
+    double alpha = 1.5;           // pareto
+    double sigma = 1.0;           // lognormal
+};
+
+inline const char* arrivalProcessName(ArrivalProcess a) {
+    switch (a) {
+        case ArrivalProcess::Uniform: return "uniform";
+        case ArrivalProcess::Poisson: return "poisson";
+        case ArrivalProcess::Mmpp:    return "mmpp";
+    }
+    return "?";
+}
+
+inline const char* sizeDistributionName(SizeDistribution s) {
+    switch (s) {
+        case SizeDistribution::Normal:      return "normal";
+        case SizeDistribution::Exponential: return "exponential";
+        case SizeDistribution::Pareto:      return "pareto";
+        case SizeDistribution::Lognormal:   return "lognormal";
+    }
+    return "?";
+}
+
+// Sets one option from its text form; false (with a message) if the key is
+// unknown or the value does not parse
+inline bool setGeneratorOption(GeneratorConfig& config, const std::string& key, const std::string& value) {
+    const char* text = value.c_str();
+    char* end = nullptr;
+    auto number = [&](double& out) {
+        out = std::strtod(text, &end);
+        return end != text && *end == '\0';
+    };
+    auto integer = [&](long long& out) {
+        out = std::strtoll(text, &end, 10);
+        return end != text && *end == '\0';
+    };
+
+    bool ok = true;
+    long long i = 0;
+    if (key == "jobs") {
+        ok = integer(i) && i >= 0 && i <= std::numeric_limits<int>::max();
+        config.jobs = static_cast<int>(i);
+    } else if (key == "seed") {
+        config.seed = std::strtoull(text, &end, 10);
+        ok = end != text && *end == '\0';
+    } else if (key == "chunk") {
+        ok = integer(i) && i > 0;
+        config.chunk = static_cast<size_t>(i);
+    } else if (key == "arrivals") {
+        if (value == "uniform") config.arrivals = ArrivalProcess::Uniform;
+        else if (value == "poisson") config.arrivals = ArrivalProcess::Poisson;
+        else if (value == "mmpp") config.arrivals = ArrivalProcess::Mmpp;
+        else ok = false;
+    } else if (key == "max_arrival") {
+        ok = integer(i) && i >= 0 && i <= std::numeric_limits<int>::max();
+        config.maxArrival = static_cast<int>(i);
+    } else if (key == "rate") {
+        ok = number(config.rate);
+    } else if (key == "burst_rate") {
+        ok = number(config.burstRate);
+    } else if (key == "calm_time") {
+        ok = number(config.calmTime);
+    } else if (key == "burst_time") {
+        ok = number(config.burstTime);
+    } else if (key == "sizes") {
+        if (value == "normal") config.sizes = SizeDistribution::Normal;
+        else if (value == "exponential") config.sizes = SizeDistribution::Exponential;
+        else if (value == "pareto") config.sizes = SizeDistribution::Pareto;
+        else if (value == "lognormal") config.sizes = SizeDistribution::Lognormal;
+        else ok = false;
+    } else if (key == "mean") {
+        ok = number(config.mean);
+    } else if (key == "stddev") {
+        ok = number(config.stddev);
+    } else if (key == "alpha") {
+        ok = number(config.alpha);
+    } else if (key == "sigma") {
+        ok = number(config.sigma);
+    } else {
+        std::cerr << "Error: unknown generator option " << key << std::endl;
+        return false;
+    }
+    if (!ok) std::cerr << "Error: bad value for " << key << ": " << value << std::endl;
+    return ok;
+}
+
+// Sets an option from "key=value" (spaces around either side are ignored)
+inline bool setGeneratorOption(GeneratorConfig& config, const std::string& assignment) {
+    size_t eq = assignment.find('=');
+    if (eq == std::string::npos) {
+        std::cerr << "Error: expected key=value, got " << assignment << std::endl;
+        return false;
+    }
+    auto trim = [](std::string s) {
+        size_t first = s.find_first_not_of(" \t\r");
+        size_t last = s.find_last_not_of(" \t\r");
+        return first == std::string::npos ? std::string() : s.substr(first, last - first + 1);
+    };
+    return setGeneratorOption(config, trim(assignment.substr(0, eq)), trim(assignment.substr(eq + 1)));
+}
+
+// Applies every "key = value" line of a config file
+inline bool loadGeneratorConfig(const std::string& path, GeneratorConfig& config) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Error: cannot open generator config " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+        if (!setGeneratorOption(config, line)) return false;
+    }
+    return true;
+}
+
+// False (with a message) if the options cannot describe a workload
+inline bool checkGeneratorConfig(const GeneratorConfig& c) {
+    const char* problem = nullptr;
+    if (c.arrivals == ArrivalProcess::Poisson && !(c.rate > 0)) problem = "rate must be > 0";
+    if (c.arrivals == ArrivalProcess::Mmpp) {
+        if (!(c.rate >= 0 && c.burstRate >= 0 && c.rate + c.burstRate > 0)) problem = "rates must be >= 0, one > 0";
+        if (!(c.calmTime > 0 && c.burstTime > 0)) problem = "calm_time and burst_time must be > 0";
+    }
+    if (!(c.mean > 0)) problem = "mean must be > 0";
+    if (c.sizes == SizeDistribution::Normal && !(c.stddev >= 0)) problem = "stddev must be >= 0";
+    if (c.sizes == SizeDistribution::Pareto && !(c.alpha > 1)) problem = "alpha must be > 1 for a finite mean";
+    if (c.sizes == SizeDistribution::Lognormal && !(c.sigma >= 0)) problem = "sigma must be >= 0";
+    if (problem) std::cerr << "Error: generator config: " << problem << std::endl;
+    return problem == nullptr;
+}
+
+// --- Samplers ---
+namespace generator_detail {
+
+inline double uniformOpen(std::mt19937& gen) { return simd_detail::unitOpen(gen()); }
+
+inline double exponential(std::mt19937& gen, double rate) { return -std::log(uniformOpen(gen)) / rate; }
+
+inline int roundSize(double x) {
+    double r = std::floor(x + 0.5);
+    if (!(r >= 1.0)) return 1;
+    return r > kMaxGeneratedSize ? kMaxGeneratedSize : static_cast<int>(r);
+}
+
+// Fills sizes[0 .. count) from gen
+inline void sampleSizes(const GeneratorConfig& c, std::mt19937& gen, int* sizes, size_t count) {
+    switch (c.sizes) {
+        case SizeDistribution::Normal:
+        case SizeDistribution::Lognormal: {
+            // Standard normals in pairs from the Box-Muller of SimdKernels.h
+            const double mu = std::log(c.mean) - 0.5 * c.sigma * c.sigma;
+            for (size_t i = 0; i < count; i += 2) {
+                double z[2];
+                simd_detail::boxMuller(gen(), gen(), z[0], z[1]);
+                for (size_t j = i; j < std::min(count, i + 2); ++j) {
+                    sizes[j] = c.sizes == SizeDistribution::Normal ? roundSize(c.mean + c.stddev * z[j - i])
+                                                                   : roundSize(std::exp(mu + c.sigma * z[j - i]));
+                }
+            }
+            return;
+        }
+        case SizeDistribution::Exponential:
+            for (size_t i = 0; i < count; ++i) sizes[i] = roundSize(exponential(gen, 1.0 / c.mean));
+            return;
+        case SizeDistribution::Pareto: {
+            const double scale = c.mean * (c.alpha - 1.0) / c.alpha; // Minimum size x_m
+            for (size_t i = 0; i < count; ++i) sizes[i] = roundSize(scale * std::pow(uniformOpen(gen), -1.0 / c.alpha));
+            return;
+        }
+    }
+}
+
+// Arrival times of `count` jobs, relative to the chunk's start, passed to
+// emit(i, time) in order; returns the time of the last one. Uniform arrivals
+// are absolute and return 0.
+template <typename Emit>
+double sampleArrivals(const GeneratorConfig& c, std::mt19937& gen, size_t count, Emit&& emit) {
+    double t = 0.0;
+    switch (c.arrivals) {
+        case ArrivalProcess::Uniform: {
+            const uint64_t range = static_cast<uint64_t>(c.maxArrival) + 1;
+            for (size_t i = 0; i < count; ++i) emit(i, static_cast<double>((static_cast<uint64_t>(gen()) * range) >> 32));
+            return 0.0;
+        }
+        case ArrivalProcess::Poisson:
+            for (size_t i = 0; i < count; ++i) {
+                t += exponential(gen, c.rate);
+                emit(i, t);
+            }
+            return t;
+        case ArrivalProcess::Mmpp: {
+            const double rates[2] = {c.rate, c.burstRate};
+            const double leave[2] = {1.0 / c.calmTime, 1.0 / c.burstTime};
+            int state = uniformOpen(gen) < c.burstTime / (c.calmTime + c.burstTime) ? 1 : 0;
+            for (size_t i = 0; i < count;) {
+                // Next event is an arrival or a state change, whichever comes first
+                double total = rates[state] + leave[state];
+                t += exponential(gen, total);
+                if (uniformOpen(gen) * total < rates[state]) emit(i++, t);
+                else state ^= 1;
+            }
+            return t;
+        }
+    }
+    return t;
+}
+
+} // namespace generator_detail
+
+// --- Parallel Generation ---
+// Replaces w with config.jobs jobs (remaining and completion times reset).
+// False if the config is invalid or the arrivals overflow the int range.
+inline bool generateWorkload(Workload& w, const GeneratorConfig& config, WorkStealingPool& pool) {
+    using namespace generator_detail;
+    if (!checkGeneratorConfig(config)) return false;
+    const size_t n = static_cast<size_t>(config.jobs);
+    const size_t chunks = (n + config.chunk - 1) / config.chunk;
+    auto bound = [&](size_t c) { return std::min(n, c * config.chunk); };
+    auto arrivalStream = [&](size_t c) { return taskGenerator(config.seed, 2 * c); };
+    auto sizeStream = [&](size_t c) { return taskGenerator(config.seed, 2 * c + 1); };
+    w.resize(n);
+
+    // Time spanned by each chunk's arrivals, then where each chunk starts
+    std::vector<double> start(chunks, 0.0);
+    if (config.arrivals != ArrivalProcess::Uniform) {
+        pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+            std::mt19937 gen = arrivalStream(c);
+            start[c] = sampleArrivals(config, gen, bound(c + 1) - bound(c), [](size_t, double) {});
+        });
+        double t = 0.0;
+        for (size_t c = 0; c < chunks; ++c) {
+            double span = start[c];
+            start[c] = t;
+            t += span;
+        }
+        if (t >= static_cast<double>(std::numeric_limits<int>::max())) {
+            std::cerr << "Error: generated arrivals reach " << t << ", past the int range; raise the rate" << std::endl;
+            return false;
+        }
+    }
+
+    pool.run(chunks, [&](size_t c, unsigned /*worker*/) {
+        std::mt19937 arrivals = arrivalStream(c);
+        int* out = w.arrivalTime.data() + bound(c);
+        sampleArrivals(config, arrivals, bound(c + 1) - bound(c),
+                       [&](size_t i, double t) { out[i] = static_cast<int>(std::floor(start[c] + t)); });
+        std::mt19937 sizes = sizeStream(c);
+        sampleSizes(config, sizes, w.totalCpuTime.data() + bound(c), bound(c + 1) - bound(c));
+        std::copy(w.totalCpuTime.begin() + bound(c), w.totalCpuTime.begin() + bound(c + 1),
+                  w.remainingCpuTime.begin() + bound(c));
+        std::fill(w.completionTime.begin() + bound(c), w.completionTime.begin() + bound(c + 1), -1);
+    });
+    return true;
+}
@@ -6,399 +6,481 @@
 #include <cmath> // For std::round, std::max
 #include <iomanip> // For std::fixed, std::setprecision
 #include <limits> // For std::numeric_limits
+#include <string>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <cstdlib> // For std::atoi, std::atof, std::strtoull
+
+#include "EventEngine.h"
+#include "SimdKernels.h"
+#include "FifoScan.h"
+#include "SweepRunner.h"
+#include "SweepDriver.h"
+#include "SimulationContext.h"
+#include "LatencyHistogram.h"
+#include "TraceReader.h"
+#include "WorkloadFile.h"
+#include "WorkloadGenerator.h"
+#include "SmpSimulator.h"
+#include "TimeSliceScheduler.h"
 
-// --- Process Structure ---
-struct Process {
-    int id;
-    int arrivalTime;
-    int totalCpuTime;     // T_i (original burst time)
-    int remainingCpuTime; // R_i
-    int completionTime;
-    int turnaroundTime;   // TT_i
-    bool active;          // Is the process competing (arrived but not finished)?
-
-    // Constructor
-    Process(int p_id = 0, int arr = 0, int cpu = 0) :
-        id(p_id),
-        arrivalTime(arr),
-        totalCpuTime(cpu),
-        remainingCpuTime(cpu),
-        completionTime(-1), // Not completed yet
-        turnaroundTime(-1), // Not calculated yet
-        active(false) {} // Initially inactive until arrival time is met
-
-    // For sorting primarily by a specific criteria, using ID as tie-breaker
-    static bool compareArrival(const Process* a, const Process* b) {
-        if (a->arrivalTime != b->arrivalTime) {
-            return a->arrivalTime < b->arrivalTime;
-        }
-        return a->id < b->id; // Tie-breaker
-    }
+// --- Helper Function to Generate Processes ---
+// Process i is job i of the structure-of-arrays workload (see Workload.h).
+// Arrivals are uniform on [0, k] and CPU times ~ N(d, v) rounded, at least 1,
+// drawn in batches by the vectorized sampler in SimdKernels.h.
+Workload generateProcesses(int n, int k, double d, double v, std::mt19937& gen) {
+    Workload workload;
+    generateWorkload(workload, n, k, d, v, gen);
+    return workload;
+}
 
-    static bool compareTotalCpuTime(const Process* a, const Process* b) {
-        if (a->totalCpuTime != b->totalCpuTime) {
-            return a->totalCpuTime < b->totalCpuTime;
-        }
-        return a->id < b->id; // Tie-breaker
-    }
+// --- Simulation Core Logic (shared event engine, see EventEngine.h) ---
+// Runs the workload through the event engine specialized for Policy, which
+// fills in completion times, and returns the average turnaround time. Ties
+// between processes always go to the lower process id.
+template <typename Policy>
+double runSimulation(Workload& workload) {
+    Simulator<Policy>().run(workload);
 
-    static bool compareRemainingCpuTime(const Process* a, const Process* b) {
-        if (a->remainingCpuTime != b->remainingCpuTime) {
-            return a->remainingCpuTime < b->remainingCpuTime;
-        }
-        return a->id < b->id; // Tie-breaker
-    }
-};
-
-// --- Helper Function to Generate Processes ---
-std::vector<Process> generateProcesses(int n, int k, double d, double v, std::mt19937& gen) {
-    std::vector<Process> processes;
-    std::uniform_int_distribution<> arrival_dist(0, k);
-    std::normal_distribution<> cpu_dist(d, v);
-
-    for (int i = 0; i < n; ++i) {
-        int arrivalTime = arrival_dist(gen);
-        // Ensure CPU time is at least 1
-        int totalCpuTime = std::max(1, static_cast<int>(std::round(cpu_dist(gen))));
-        processes.emplace_back(i, arrivalTime, totalCpuTime);
+    // Calculate Average Turnaround Time (ATT)
+    TurnaroundStats stats = reduceTurnaround(workload);
+    if (stats.completed != workload.size()) {
+        // This indicates an error or incomplete simulation
+        std::cerr << "Warning: completed " << stats.completed << "/" << workload.size() << " processes." << std::endl;
     }
-    return processes;
+    return stats.mean;
 }
 
-// --- Simulation Core Logic (Common parts refactored if desired, or separate for clarity) ---
-
 // --- FIFO Simulation ---
-double simulateFIFO(std::vector<Process> processes, int n) {
-    int currentTime = 0;
-    int completedProcesses = 0;
-    std::vector<Process*> readyQueue; // Pointers to processes ready to run
-
-    while (completedProcesses < n) {
-        // 1. Check for new arrivals
-        for (Process& p : processes) {
-            if (!p.active && p.arrivalTime <= currentTime && p.completionTime == -1) {
-                p.active = true;
-                readyQueue.push_back(&p);
-                // Sort ready queue by arrival time (FIFO) upon insertion
-                std::sort(readyQueue.begin(), readyQueue.end(), Process::compareArrival);
-            }
-        }
+double simulateFIFO(Workload& workload) {
+    // Earliest arrival first, each process runs to completion, so completion
+    // times follow a prefix scan instead of an event loop (see FifoScan.h)
+    runFifoScan(workload);
+    return reduceTurnaround(workload).mean;
+}
 
-        // 2. Handle Idle Time
-        if (readyQueue.empty()) {
-            // Advance time to the next arrival if no process is ready
-             int nextArrivalTime = std::numeric_limits<int>::max();
-             bool foundNext = false;
-             for(const auto& p : processes) {
-                 if(p.completionTime == -1 && p.arrivalTime > currentTime) { // Find earliest future arrival
-                     nextArrivalTime = std::min(nextArrivalTime, p.arrivalTime);
-                     foundNext = true;
-                 }
-             }
-             // If no processes arrived yet and queue is empty, go to first arrival
-             // If some completed and queue empty, go to next arrival
-             if(foundNext) {
-                 currentTime = nextArrivalTime;
-             } else if (completedProcesses < n) {
-                 // Should not happen if generateProcesses guarantees arrivals <= k,
-                 // but as a safeguard if queue is empty and no future arrivals found,
-                 // break or increment time (let's increment).
-                 currentTime++;
-             } else {
-                 break; // All done
-             }
-            continue; // Re-check arrivals at the new time
-        }
 
-        // 3. Choose Process (FIFO: the one at the front of the sorted readyQueue)
-        Process* currentProcess = readyQueue.front();
-        readyQueue.erase(readyQueue.begin()); // Remove from ready queue *conceptually* - it will run to completion
-
-        // 4. Simulate Execution (Non-preemptive)
-        // No need to check arrival time here, it was handled above.
-        // The process runs for its *entire* burst time.
-        currentTime += currentProcess->totalCpuTime; // Time jumps to completion
-        currentProcess->remainingCpuTime = 0;
-
-
-        // 5. Handle Completion
-        currentProcess->completionTime = currentTime;
-        currentProcess->turnaroundTime = currentProcess->completionTime - currentProcess->arrivalTime;
-        currentProcess->active = false; // No longer active
-        completedProcesses++;
-
-        // Crucially, after a process completes at the *new* currentTime,
-        // check for any processes that might have arrived *during* its execution.
-        // This loop ensures that newly arrived processes are added *before* the next cycle.
-        // (Note: This check is simplified here; a more robust implementation might
-        // check arrivals *at each time step* if events could occur mid-burst, but
-        // for basic FIFO/SJF/SRT simulation step-by-step or burst-by-burst is common)
-        // Let's refine the loop: check arrivals *before* choosing the next process.
-        // The above loop does this.
-    }
+// --- SJF Simulation (Non-Preemptive) ---
+double simulateSJF(Workload& workload) {
+    // Shortest total CPU time first, chosen whenever the CPU becomes idle
+    return runSimulation<SjfPolicy>(workload);
+}
 
-    // Calculate Average Turnaround Time (ATT)
-    double totalTurnaroundTime = 0;
-    for (const auto& p : processes) {
-         if (p.turnaroundTime != -1) { // Ensure it completed
-              totalTurnaroundTime += p.turnaroundTime;
-         } else {
-             // This indicates an error or incomplete simulation
-             std::cerr << "Warning: Process " << p.id << " did not complete." << std::endl;
-         }
-    }
-    return (completedProcesses > 0) ? (totalTurnaroundTime / completedProcesses) : 0.0;
+
+// --- SRT Simulation (Preemptive) ---
+double simulateSRT(Workload& workload) {
+    // Shortest remaining CPU time first, re-evaluated whenever a process arrives
+    return runSimulation<SrtPolicy>(workload);
 }
 
 
-// --- SJF Simulation (Non-Preemptive) ---
-double simulateSJF(std::vector<Process> processes, int n) {
-    int currentTime = 0;
-    int completedProcesses = 0;
-    std::vector<Process*> readyQueue; // Pointers to processes ready to run
-    Process* runningProcess = nullptr; // No process running initially
-
-    while (completedProcesses < n) {
-         // 1. Check for new arrivals and add to ready queue
-        for (Process& p : processes) {
-            // Add if: arrived, not yet completed, not already running or in ready queue
-            if (p.arrivalTime <= currentTime && p.completionTime == -1 && !p.active) {
-                 // Check if it's the currently running process (shouldn't be if completionTime == -1, but safety)
-                 if (&p != runningProcess) {
-                    p.active = true; // Mark as active/ready
-                    readyQueue.push_back(&p);
-                 }
-            }
-        }
+// --- Round-Robin Simulation (Preemptive) ---
+double simulateRR(Workload& workload, int quantum) {
+    // Arrival order, each process runs for at most one quantum at a time
+    TimeSliceSimulator(roundRobinConfig(quantum)).run(workload);
+    return reduceTurnaround(workload).mean;
+}
 
-        // 2. If CPU is idle and ready queue is not empty, choose next process
-        if (runningProcess == nullptr && !readyQueue.empty()) {
-            // Sort ready queue by total CPU time (SJF)
-            std::sort(readyQueue.begin(), readyQueue.end(), Process::compareTotalCpuTime);
-            runningProcess = readyQueue.front(); // Select shortest job
-            readyQueue.erase(readyQueue.begin()); // Remove from ready queue
-            // runningProcess->active remains true (it's active because it's running)
-        }
 
-        // 3. Handle Idle Time or Advance Time
-        if (runningProcess == nullptr) {
-            // CPU is idle, and ready queue is empty. Advance time.
-             int nextArrivalTime = std::numeric_limits<int>::max();
-             bool foundNext = false;
-             for(const auto& p : processes) {
-                 // Look for the earliest arrival among non-completed processes
-                 if(p.completionTime == -1 && p.arrivalTime > currentTime) {
-                     nextArrivalTime = std::min(nextArrivalTime, p.arrivalTime);
-                     foundNext = true;
-                 }
-             }
-             if (foundNext) {
-                currentTime = nextArrivalTime; // Jump to the next arrival time
-             } else if (completedProcesses < n) {
-                 // No running process, nothing in ready queue, no future arrivals pending?
-                 // This might mean all remaining processes have arrived but simulation stuck.
-                 // Or simply advance time by 1 if nothing else to do.
-                 // If readyQueue was checked correctly, this shouldn't happen unless all processes done.
-                 if (!readyQueue.empty()) {
-                     // This case should ideally not be reached if logic is correct
-                      currentTime++;
-                 } else {
-                     // Break if truly nothing left to do.
-                     if(completedProcesses == n) break;
-                     // Otherwise, advance time by 1 if stuck? Or maybe error state.
-                     // Let's try advancing time if arrivals check was exhaustive
-                     currentTime++;
-                 }
-             } else {
-                 break; // All completed
-             }
-            continue; // Re-evaluate at the new time
-        }
+// --- MLFQ Simulation (Preemptive) ---
+double simulateMLFQ(Workload& workload, const TimeSliceConfig& config) {
+    // Processes that use up their slices sink to lower, longer-slice levels
+    TimeSliceSimulator(config).run(workload);
+    return reduceTurnaround(workload).mean;
+}
 
-        // 4. Simulate one time unit for the running process
-        currentTime++;
-        if (runningProcess) { // Ensure runningProcess is not null
-             runningProcess->remainingCpuTime--;
-
-             // 5. Handle Completion
-             if (runningProcess->remainingCpuTime == 0) {
-                 runningProcess->completionTime = currentTime;
-                 runningProcess->turnaroundTime = runningProcess->completionTime - runningProcess->arrivalTime;
-                 runningProcess->active = false; // No longer active/running
-                 completedProcesses++;
-                 runningProcess = nullptr; // CPU becomes idle
-             }
-        } else {
-             // Should not happen if idle time handling is correct
-             // currentTime++; // Already incremented above loop
-        }
 
-    } // End while loop
+// --- Latency vs. Throughput ---
+// Runs every algorithm on a saved workload with response time and context
+// switches metered (see MeteredJobs in EventEngine.h) alongside ATT.
+template <typename Sim>
+void printLatencyRow(const char* name, Sim&& sim, Workload& workload) {
+    workload.reset();
+    WorkloadJobs jobs(workload);
+    MeteredJobs<WorkloadJobs> metered(jobs);
+    sim.run(metered);
+    const LatencyStats& latency = metered.stats();
+    std::cout << name << "\t" << reduceTurnaround(workload).mean << "\t" << latency.averageResponse()
+              << "\t" << latency.maxResponseTime << "\t" << latency.contextSwitches << "\n";
+}
 
-    // Calculate Average Turnaround Time (ATT)
-    double totalTurnaroundTime = 0;
-    int actualCompleted = 0;
-    for (const auto& p : processes) {
-        if (p.turnaroundTime != -1) {
-            totalTurnaroundTime += p.turnaroundTime;
-            actualCompleted++;
-        } else {
-             // std::cerr << "Warning: SJF Process " << p.id << " did not complete." << std::endl;
-        }
-    }
-     if (actualCompleted != n) {
-          // std::cerr << "Warning: SJF completed " << actualCompleted << "/" << n << " processes." << std::endl;
-     }
-    return (actualCompleted > 0) ? (totalTurnaroundTime / actualCompleted) : 0.0;
+int runTimeSliceComparison(const std::string& path, int quantum, int levels, long long boost_period) {
+    Workload workload;
+    if (!loadWorkload(path, workload)) return 1;
+    std::cout << "# workload=" << path
+              << "  quantum=" << quantum
+              << "  mlfq_levels=" << levels
+              << "  boost_period=" << boost_period << "\n";
+    std::cout << "algorithm\tATT\tmean_response\tmax_response\tcontext_switches\n";
+    std::cout << std::fixed << std::setprecision(4); // Format output
+    printLatencyRow("FIFO", Simulator<FifoPolicy>(), workload);
+    printLatencyRow("SJF", Simulator<SjfPolicy>(), workload);
+    printLatencyRow("SRT", Simulator<SrtPolicy>(), workload);
+    printLatencyRow("RR", TimeSliceSimulator(roundRobinConfig(quantum)), workload);
+    printLatencyRow("MLFQ", TimeSliceSimulator(mlfqConfig(levels, quantum, boost_period)), workload);
+    return 0;
 }
 
 
-// --- SRT Simulation (Preemptive) ---
-double simulateSRT(std::vector<Process> processes, int n) {
-    int currentTime = 0;
-    int completedProcesses = 0;
-    std::vector<Process*> readyQueue; // Pointers to processes ready to run (or potentially run)
-    Process* runningProcess = nullptr; // Currently running process
-
-    while (completedProcesses < n) {
-        // 1. Check for new arrivals and add to ready queue
-        for (Process& p : processes) {
-             // Add if: arrived, not yet completed, and not already in ready queue or running
-            if (p.arrivalTime <= currentTime && p.completionTime == -1 && !p.active) {
-                 bool alreadyInQueue = false;
-                 for(const auto* rp : readyQueue) if (rp->id == p.id) alreadyInQueue = true;
-                 if (!alreadyInQueue && (&p != runningProcess)) {
-                    p.active = true; // Mark as ready/active
-                    readyQueue.push_back(&p);
-                 }
-            }
-        }
+// --- Event Timeline ---
+// Runs a saved workload through FIFO, SJF, SRT and Round-Robin with event
+// tracing on (needs a -DSCHEDULER_TRACING build, see SchedTrace.h) and writes
+// a Chrome/Perfetto trace of every dispatch, preemption, slice expiry,
+// arrival and completion. Other builds fail before simulating anything.
+int writeTimeline(const std::string& path, const std::string& out_path, int quantum) {
+    if (!kSchedulerTracing) {
+        std::cerr << "Error: --timeline needs a build with -DSCHEDULER_TRACING" << std::endl;
+        return 1;
+    }
+    Workload workload;
+    if (!loadWorkload(path, workload)) return 1;
+    runSimulation<FifoPolicy>(workload); // The closed-form FIFO records no events
+    SCHED_TRACE_LABEL("FIFO");
+    simulateSJF(workload);
+    SCHED_TRACE_LABEL("SJF");
+    simulateSRT(workload);
+    SCHED_TRACE_LABEL("SRT");
+    simulateRR(workload, quantum);
+    SCHED_TRACE_LABEL("RR");
+    return exportChromeTrace(out_path) ? 0 : 1;
+}
 
-        // 2. Add the currently running process back to ready queue if it exists (for preemption check)
-        if (runningProcess) {
-            readyQueue.push_back(runningProcess);
-            runningProcess = nullptr; // Temporarily make CPU idle for selection
-        }
 
-        // 3. Choose Process (SRT: shortest *remaining* time)
-        if (!readyQueue.empty()) {
-            // Sort by remaining CPU time
-            std::sort(readyQueue.begin(), readyQueue.end(), Process::compareRemainingCpuTime);
-            runningProcess = readyQueue.front(); // Select shortest remaining time job
-            readyQueue.erase(readyQueue.begin()); // Remove it from ready queue (it's now running)
-        }
+// --- Trace Replay ---
+// Streams a recorded job trace (CSV or binary, see TraceReader.h) or a saved
+// workload file (WorkloadFile.h) through each algorithm in turn; only live
+// jobs are held in memory.
+TraceStats simulateFile(const std::string& path, QueueKey key, bool preemptive) {
+    if (isWorkloadFile(path)) {
+        WorkloadFileReader reader(path);
+        return simulateTrace(reader, key, preemptive);
+    }
+    return simulateTraceFile(path, key, preemptive);
+}
 
-        // 4. Handle Idle Time
-        if (runningProcess == nullptr) {
-            // CPU is idle, and ready queue is empty. Advance time.
-            int nextArrivalTime = std::numeric_limits<int>::max();
-            bool foundNext = false;
-            for(const auto& p : processes) {
-                 if(p.completionTime == -1 && p.arrivalTime > currentTime) {
-                     nextArrivalTime = std::min(nextArrivalTime, p.arrivalTime);
-                     foundNext = true;
-                 }
-             }
-            if (foundNext) {
-                currentTime = nextArrivalTime;
-             } else if (completedProcesses < n) {
-                 // If queue is empty and no future arrivals, maybe advance time by 1?
-                 currentTime++;
-             } else {
-                 break; // All completed
-             }
-            continue; // Re-evaluate at the new time
-        }
+int replayTrace(const std::string& path) {
+    const char* names[] = { "FIFO", "SJF", "SRT" };
+    const QueueKey keys[] = { QueueKey::Arrival, QueueKey::TotalCpu, QueueKey::RemainingCpu };
+    const bool preemptive[] = { false, false, true };
 
-        // 5. Simulate one time unit
-        currentTime++;
-        if (runningProcess) { // Check again, as it might be null after idle handling
-            runningProcess->remainingCpuTime--;
-
-            // 6. Handle Completion
-            if (runningProcess->remainingCpuTime == 0) {
-                runningProcess->completionTime = currentTime;
-                runningProcess->turnaroundTime = runningProcess->completionTime - runningProcess->arrivalTime;
-                runningProcess->active = false; // No longer active/competing
-                completedProcesses++;
-                runningProcess = nullptr; // CPU becomes idle for the next cycle's selection
-            }
-            // Note: If not completed, runningProcess might be preempted in the next cycle
-            // because it's added back to readyQueue in step 2.
-        } else {
-             // Should not be reached if logic is correct
-            // currentTime++; // Already incremented
-        }
+    std::cout << "# trace=" << path << "\n";
+    std::cout << "algorithm\tjobs\tATT\tmax_TT\tpeak_live_jobs\n";
+    std::cout << std::fixed << std::setprecision(4); // Format output
+    for (int a = 0; a < 3; ++a) {
+        TraceStats stats = simulateFile(path, keys[a], preemptive[a]);
+        if (!stats.ok) return 1;
+        std::cout << names[a] << "\t" << stats.completed << "\t" << stats.averageTurnaround()
+                  << "\t" << stats.maxTurnaroundTime << "\t" << stats.peakLiveJobs << "\n";
     }
+    return 0;
+}
 
-    // Calculate Average Turnaround Time (ATT)
-    double totalTurnaroundTime = 0;
-    int actualCompleted = 0;
-    for (const auto& p : processes) {
-        if (p.turnaroundTime != -1) {
-            totalTurnaroundTime += p.turnaroundTime;
-            actualCompleted++;
-        } else {
-           // std::cerr << "Warning: SRT Process " << p.id << " did not complete." << std::endl;
-        }
+// Streams a trace or workload file through each algorithm and prints tail
+// percentiles of turnaround, waiting time and slowdown from the constant-
+// memory histograms in LatencyHistogram.h
+int replayTails(const std::string& path) {
+    const char* names[] = { "FIFO", "SJF", "SRT" };
+    const QueueKey keys[] = { QueueKey::Arrival, QueueKey::TotalCpu, QueueKey::RemainingCpu };
+    const bool preemptive[] = { false, false, true };
+    const double percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+
+    std::cout << "# trace=" << path << "\n";
+    std::cout << "algorithm\tjobs";
+    for (const char* metric : { "TT", "wait", "slowdown" }) {
+        for (const char* p : { "p50", "p90", "p99", "p99.9" }) std::cout << "\t" << metric << "_" << p;
+    }
+    std::cout << "\n";
+    std::cout << std::fixed << std::setprecision(3); // Format output
+    for (int a = 0; a < 3; ++a) {
+        TraceStats stats = simulateFile(path, keys[a], preemptive[a]);
+        if (!stats.ok) return 1;
+        std::cout << names[a] << "\t" << stats.completed;
+        for (double p : percentiles) std::cout << "\t" << stats.latency.turnaround.percentile(p);
+        for (double p : percentiles) std::cout << "\t" << stats.latency.waiting.percentile(p);
+        for (double p : percentiles) std::cout << "\t" << stats.latency.slowdownPercentile(p);
+        std::cout << "\n";
     }
-     if (actualCompleted != n) {
-         // std::cerr << "Warning: SRT completed " << actualCompleted << "/" << n << " processes." << std::endl;
-     }
-    return (actualCompleted > 0) ? (totalTurnaroundTime / actualCompleted) : 0.0;
+    return 0;
 }
 
+// --- Saved Workloads ---
+// Generates one workload and saves it, so every run and every team member
+// can simulate exactly the same input.
+int saveGeneratedWorkload(const std::string& path, int n, int k, double d, double v_percentage, uint64_t seed) {
+    double v = d * v_percentage;
+    if (v < 1.0) v = 1.0; // Ensure minimum standard deviation
+    std::mt19937 gen = taskGenerator(seed, 0);
+    Workload workload = generateProcesses(n, k, d, v, gen);
+    return saveWorkload(path, workload, WorkloadParams{k, d, v, seed}) ? 0 : 1;
+}
 
-// --- Main Driver ---
-int main() {
-    // Simulation Parameters
-    int n = 50;              // Number of processes
-    int k = 1000;            // Max arrival time
-    double v_percentage = 1.0; // Standard deviation as a percentage of d (e.g., 30%)
-
-    // Average CPU times to test (d values)
-    // Select values relative to k/n (average arrival interval)
-    double avg_arrival_interval = static_cast<double>(k) / n; 
-    std::vector<double> d_values;
-    // Examples: Much smaller, around, and much larger than avg_arrival_interval
-    d_values.push_back(avg_arrival_interval * 0.1);  // d = 2 (Low contention)
-    d_values.push_back(avg_arrival_interval * 0.5);  // d = 10
-    d_values.push_back(avg_arrival_interval * 1.0);  // d = 20 (Moderate contention)
-    d_values.push_back(avg_arrival_interval * 2.0);  // d = 40
-    d_values.push_back(avg_arrival_interval * 5.0);  // d = 100 (High contention)
-    d_values.push_back(avg_arrival_interval * 10.0); // d = 200 (Very high contention)
-
-
-    // Random Number Generator Setup
-    std::random_device rd;
-    std::mt19937 gen(rd()); // Mersenne Twister engine seeded with random_device
-
-    std::cout << "# n=" << n
-          << "  k=" << k
-          << "  v_pct=" << v_percentage << "\n";
+// Generates a workload from a generator config (see WorkloadGenerator.h) and
+// saves it. Arguments are config files and key=value options, applied in
+// order; the header records the largest arrival as k, the configured mean as
+// d and the sample standard deviation of the sizes as v.
+int saveConfiguredWorkload(const std::string& path, const std::vector<std::string>& options) {
+    GeneratorConfig config;
+    for (const std::string& option : options) {
+        bool ok = option.find('=') != std::string::npos ? setGeneratorOption(config, option)
+                                                        : loadGeneratorConfig(option, config);
+        if (!ok) return 1;
+    }
+    WorkStealingPool pool;
+    Workload workload;
+    if (!generateWorkload(workload, config, pool)) return 1;
+
+    double sum = 0, sumSq = 0;
+    int last = 0, largest = 0;
+    for (size_t i = 0; i < workload.size(); ++i) {
+        sum += workload.totalCpuTime[i];
+        sumSq += static_cast<double>(workload.totalCpuTime[i]) * workload.totalCpuTime[i];
+        last = std::max(last, workload.arrivalTime[i]);
+        largest = std::max(largest, workload.totalCpuTime[i]);
+    }
+    double n = static_cast<double>(std::max<size_t>(1, workload.size()));
+    double sd = std::sqrt(std::max(0.0, sumSq / n - (sum / n) * (sum / n)));
+    std::cout << "# jobs=" << workload.size() << "  arrivals=" << arrivalProcessName(config.arrivals)
+              << "  sizes=" << sizeDistributionName(config.sizes) << "  seed=" << config.seed
+              << "  last_arrival=" << last << "  mean_size=" << sum / n << "  sd_size=" << sd
+              << "  max_size=" << largest << "  load=" << (last > 0 ? sum / last : 0.0) << "\n";
+    return saveWorkload(path, workload, WorkloadParams{last, config.mean, sd, config.seed}) ? 0 : 1;
+}
+
+// Loads a saved workload and runs FIFO, SJF and SRT on it
+int runSavedWorkload(const std::string& path) {
+    Workload workload;
+    WorkloadFileHeader header{};
+    if (!loadWorkload(path, workload, &header)) return 1;
+
+    std::cout << "# workload=" << path
+              << "  n=" << header.jobCount
+              << "  k=" << header.k
+              << "  d=" << header.d
+              << "  v=" << header.v
+              << "  seed=" << header.seed << "\n";
     std::cout << "d\tATT_FIFO\td/ATT_FIFO\tATT_SJF\td/ATT_SJF\tATT_SRT\td/ATT_SRT\n";
     std::cout << std::fixed << std::setprecision(4); // Format output
+    double d = header.d;
+    double att_fifo = simulateFIFO(workload);
+    double att_sjf = simulateSJF(workload);
+    double att_srt = simulateSRT(workload);
+    std::cout << d << "\t"
+              << att_fifo << "\t" << (att_fifo > 0 ? d / att_fifo : 0.0) << "\t"
+              << att_sjf << "\t" << (att_sjf > 0 ? d / att_sjf : 0.0) << "\t"
+              << att_srt << "\t" << (att_srt > 0 ? d / att_srt : 0.0) << "\n";
+    return 0;
+}
 
-    // Run simulation for each d value
-    for (double d : d_values) {
-        double v = d * v_percentage;
-        if (v < 1.0) v = 1.0; // Ensure minimum standard deviation
-
-        // Generate ONE set of processes for this d
-        std::vector<Process> initial_processes = generateProcesses(n, k, d, v, gen);
+// --- Multi-Core Scaling ---
+// Runs a saved workload on 1, 2, 4, ... up to max_cpus CPUs (see SmpSimulator.h)
+// and prints ATT plus per-core utilization for each algorithm.
+int runSmpScaling(const std::string& path, int max_cpus, SmpQueueing queueing, int migration_cost) {
+    Workload workload;
+    if (!loadWorkload(path, workload)) return 1;
+    const char* names[] = { "FIFO", "SJF", "SRT" };
+    const QueueKey keys[] = { QueueKey::Arrival, QueueKey::TotalCpu, QueueKey::RemainingCpu };
+    const bool preemptive[] = { false, false, true };
+
+    std::cout << "# workload=" << path
+              << "  queueing=" << (queueing == SmpQueueing::PerCpu ? "percpu" : "global")
+              << "  migration_cost=" << migration_cost << "\n";
+    std::cout << "cpus\talgorithm\tATT\tmean_util\tpreemptions\tmigrations\tsteals\tper_core_util\n";
+    std::cout << std::fixed << std::setprecision(4); // Format output
+    for (int m = 1; ; m = std::min(m * 2, max_cpus)) {
+        SmpConfig config;
+        config.cpus = m;
+        config.queueing = queueing;
+        config.migrationCost = migration_cost;
+        for (int a = 0; a < 3; ++a) {
+            SmpStats stats = runSmpSimulation(workload, keys[a], preemptive[a], config);
+            double mean_util = 0;
+            for (double u : stats.utilization) mean_util += u;
+            std::cout << m << "\t" << names[a] << "\t" << stats.averageTurnaround << "\t" << mean_util / m
+                      << "\t" << stats.preemptions << "\t" << stats.migrations << "\t" << stats.steals << "\t";
+            for (int c = 0; c < m; ++c) std::cout << (c ? "," : "") << stats.utilization[c];
+            std::cout << "\n";
+        }
+        if (m >= max_cpus) break;
+    }
+    return 0;
+}
 
-        // --- Run Simulations (pass copies to keep initial_processes unchanged) ---
-        double att_fifo = simulateFIFO(initial_processes, n);
-        double att_sjf = simulateSJF(initial_processes, n);
-        double att_srt = simulateSRT(initial_processes, n);
+// --- Parameter Sweep ---
+// Per-worker state of the sweep: the reusable simulation context, and the
+// turnaround histograms of every algorithm for the point the worker is on.
+// When the worker moves to another point they are merged into that point's
+// pooled histograms, so memory does not grow with threads times points.
+struct SweepWorker {
+    SimulationContext simulation;
+    size_t point = std::numeric_limits<size_t>::max(); // Point the histograms hold
+    std::vector<StreamingHistogram> turnaround;         // One per algorithm
+};
 
-        // --- Output Results ---
-        std::cout << d << "\t"
-                  << att_fifo << "\t" << (att_fifo > 0 ? d / att_fifo : 0.0) << "\t"
-                  << att_sjf << "\t" << (att_sjf > 0 ? d / att_sjf : 0.0) << "\t"
-                  << att_srt << "\t" << (att_srt > 0 ? d / att_srt : 0.0) << "\n";
+// Sweeps every (d, v_pct, n, k) point of the grid with Monte-Carlo
+// replications on the pool and prints mean, sample stddev and 95% CI
+// half-width of ATT per algorithm, and the p99 turnaround over every job of
+// the point's replications; the CSV/JSON records asked for in config also get
+// the simulation time and events per second (see SweepDriver.h).
+int runParameterSweep(const SweepConfig& config) {
+    WorkStealingPool pool(config.threads ? config.threads : std::thread::hardware_concurrency());
+    const std::vector<SweepPoint> points = sweepPoints(config);
+    const std::vector<SweepAlgorithm>& algorithms = config.algorithms;
+    const size_t count = algorithms.size();
+
+    // Pooled turnaround histograms per point and algorithm
+    std::vector<std::vector<StreamingHistogram>> pooled(points.size());
+    std::mutex pooledLock;
+    auto flush = [&](SweepWorker& worker) {
+        if (worker.point == std::numeric_limits<size_t>::max()) return;
+        std::lock_guard<std::mutex> guard(pooledLock);
+        std::vector<StreamingHistogram>& target = pooled[worker.point];
+        if (target.empty()) target.resize(count);
+        for (size_t a = 0; a < count; ++a) {
+            target[a].merge(worker.turnaround[a]);
+            worker.turnaround[a].clear();
+        }
+    };
+
+    // Each replication generates ONE set of processes and runs every algorithm on it,
+    // in the worker's context so no replication after the first allocates. out[a] is
+    // the ATT of algorithm a and out[count + a] the seconds it took.
+    auto replicate = [&](const SweepPoint& point, std::mt19937& gen, SweepWorker& worker, double* out) {
+        const size_t p = static_cast<size_t>(&point - points.data());
+        if (worker.point != p) {
+            flush(worker);
+            worker.turnaround.resize(count);
+            worker.point = p;
+        }
+        SimulationContext& context = worker.simulation;
+        double v = point.d * point.vPct;
+        if (v < 1.0) v = 1.0; // Ensure minimum standard deviation
+        context.generate(point.n, point.k, point.d, v, gen);
+        for (size_t a = 0; a < count; ++a) {
+            auto start = std::chrono::steady_clock::now();
+            switch (algorithms[a]) {
+                case SweepAlgorithm::Fifo: out[a] = context.run<FifoPolicy>(); break;
+                case SweepAlgorithm::Sjf: out[a] = context.run<SjfPolicy>(); break;
+                case SweepAlgorithm::Srt: out[a] = context.run<SrtPolicy>(); break;
+            }
+            out[count + a] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const Workload& w = context.workload();
+            for (size_t i = 0; i < w.size(); ++i) {
+                if (w.completionTime[i] != -1) worker.turnaround[a].record(w.completionTime[i] - w.arrivalTime[i]);
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SweepWorker> workers;
+    std::vector<std::vector<Summary>> results =
+        runSweep<SweepWorker>(points, config.replications, 2 * count, config.seed, pool, replicate, &workers);
+    for (SweepWorker& worker : workers) flush(worker);
+    double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto p99 = [&](size_t p, size_t a) {
+        return pooled[p].empty() ? 0.0 : static_cast<double>(pooled[p][a].percentile(99.0));
+    };
+
+    // --- Output Results (mean, sample stddev and 95% CI half-width of ATT) ---
+    std::vector<SweepRecord> records;
+    std::cout << std::fixed << std::setprecision(4); // Format output
+    for (size_t p = 0; p < points.size(); ++p) {
+        const SweepPoint& point = points[p];
+        if (p == 0 || point.n != points[p - 1].n || point.k != points[p - 1].k ||
+            point.vPct != points[p - 1].vPct) {
+            std::cout << std::setprecision(2)
+                      << "# n=" << point.n
+                      << "  k=" << point.k
+                      << "  v_pct=" << point.vPct
+                      << "  replications=" << config.replications
+                      << "  seed=" << config.seed
+                      << "  threads=" << pool.threadCount() << "\n"
+                      << std::setprecision(4);
+            std::cout << "d";
+            for (SweepAlgorithm algorithm : algorithms) {
+                const char* name = sweepAlgorithmName(algorithm);
+                std::cout << "\tATT_" << name << "\tsd_" << name << "\tci95_" << name << "\td/ATT_" << name
+                          << "\tp99_" << name;
+            }
+            std::cout << "\n";
+        }
+        std::cout << point.d;
+        for (size_t a = 0; a < count; ++a) {
+            const Summary& s = results[p][a];
+            std::cout << "\t" << s.mean << "\t" << s.stddev << "\t" << s.ci95
+                      << "\t" << (s.mean > 0 ? point.d / s.mean : 0.0) << "\t" << p99(p, a);
+            records.push_back({point, algorithms[a], s, p99(p, a), results[p][count + a].mean * config.replications});
+        }
+        std::cout << "\n";
     }
-    
 
+    if (!config.csvPath.empty() &&
+        !writeSweepCsv(config.csvPath, config, pool.threadCount(), wall_seconds, records)) {
+        return 1;
+    }
+    if (!config.jsonPath.empty() &&
+        !writeSweepJson(config.jsonPath, config, pool.threadCount(), wall_seconds, records)) {
+        return 1;
+    }
     return 0;
 }
+
+// --- Main Driver ---
+// Usage: geminiversion [--key=value ...]    run the parameter sweep (flags: SweepDriver.h)
+//        geminiversion --trace <file>       replay a job trace or workload file, streaming
+//        geminiversion --tails <file>       same, reporting p50/p90/p99/p99.9 latencies
+//        geminiversion --workload <file>    load a saved workload and simulate it
+//        geminiversion --save-workload <file> <n> <k> <d> <v_pct> <seed>
+//        geminiversion --generate <file> [<config> | key=value ...]
+//        geminiversion --smp <file> <max_cpus> <global|percpu> <migration_cost>
+//        geminiversion --timeslice <file> <quantum> <mlfq_levels> <boost_period>
+//        geminiversion --timeline <file> <out.json> <quantum>   (-DSCHEDULER_TRACING builds)
+// Benchmark.cpp includes this file with SCHEDULER_NO_MAIN defined.
+#ifndef SCHEDULER_NO_MAIN
+int main(int argc, char* argv[]) {
+    std::string mode = argc > 1 ? argv[1] : "";
+    if (argc == 3 && mode == "--trace") {
+        return replayTrace(argv[2]);
+    }
+    if (argc == 3 && mode == "--tails") {
+        return replayTails(argv[2]);
+    }
+    if (argc == 3 && mode == "--workload") {
+        return runSavedWorkload(argv[2]);
+    }
+    if (argc == 8 && mode == "--save-workload") {
+        return saveGeneratedWorkload(argv[2], std::atoi(argv[3]), std::atoi(argv[4]), std::atof(argv[5]),
+                                     std::atof(argv[6]), std::strtoull(argv[7], nullptr, 10));
+    }
+    if (argc >= 3 && mode == "--generate") {
+        return saveConfiguredWorkload(argv[2], std::vector<std::string>(argv + 3, argv + argc));
+    }
+    if (argc == 6 && mode == "--smp") {
+        SmpQueueing queueing = std::string(argv[4]) == "percpu" ? SmpQueueing::PerCpu : SmpQueueing::Global;
+        return runSmpScaling(argv[2], std::max(1, std::atoi(argv[3])), queueing, std::atoi(argv[5]));
+    }
+    if (argc == 5 && mode == "--timeline") {
+        return writeTimeline(argv[2], argv[3], std::max(1, std::atoi(argv[4])));
+    }
+    if (argc == 6 && mode == "--timeslice") {
+        return runTimeSliceComparison(argv[2], std::max(1, std::atoi(argv[3])), std::atoi(argv[4]),
+                                      std::atoll(argv[5]));
+    }
+    if (argc > 1 && mode.find('=') == std::string::npos) {
+        std::cerr << "Usage: " << argv[0] << " [--key=value ... (see SweepDriver.h) | --trace <file> | --tails <file> | --workload <file> | "
+                  << "--save-workload <file> <n> <k> <d> <v_pct> <seed> | "
+                  << "--generate <file> [<config> | key=value ...] | "
+                  << "--smp <file> <max_cpus> <global|percpu> <migration_cost> | "
+                  << "--timeslice <file> <quantum> <mlfq_levels> <boost_period> | "
+                  << "--timeline <file> <out.json> <quantum>]" << std::endl;
+        return 1;
+    }
+
+    // Sweep flags (see SweepDriver.h); with none, the default sweep runs
+    SweepConfig config;
+    for (int i = 1; i < argc; ++i) {
+        if (!setSweepOption(config, argv[i])) return 1;
+    }
+    return runParameterSweep(config);
+}
+#endif // SCHEDULER_NO_MAIN
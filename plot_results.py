@@ -0,0 +1,31 @@
+import csv
+import sys
+from collections import defaultdict
+
+import matplotlib.pyplot as plt
+
+# Plots ATT against d for every (n, k, v_pct) in a CSV file written by
+# geminiversion --csv=<file>, one line per algorithm with 95% CI error bars
+path = sys.argv[1] if len(sys.argv) > 1 else 'results.csv'
+series = defaultdict(lambda: defaultdict(list))
+with open(path) as f:
+    for row in csv.DictReader(f):
+        key = (int(row['n']), int(row['k']), float(row['v_pct']))
+        series[key][row['algorithm']].append((float(row['d']), float(row['att_mean']), float(row['att_ci95'])))
+
+for (n, k, v_pct), algorithms in series.items():
+    plt.figure()
+    for name, points in algorithms.items():
+        d, att, ci95 = zip(*sorted(points))
+        plt.errorbar(d, att, yerr=ci95, marker='o', capsize=3, label=name)
+
+    # Styling
+    plt.title(f'Average Turnaround Time vs d (n={n}, k={k}, v_pct={v_pct})')
+    plt.xlabel('d (Average CPU Burst Time)')
+    plt.ylabel('Average Turnaround Time (ATT)')
+    plt.grid(True)
+    plt.legend()
+    plt.tight_layout()
+
+# Show the plots
+plt.show()